@@ -0,0 +1,509 @@
+#include <string.h>
+
+#include "audio_clips.h"
+
+// Placeholder effects synthesised from tones. Replace one by encoding a
+// 16 kHz mono recording with host/audio_tool encode and pasting the array.
+namespace
+{
+    // beep: 3200 samples, 0.20 s
+    const uint8_t beep[] = {
+        0x70, 0x77, 0x77, 0x94, 0xda, 0xcc, 0xab, 0x09, 0x63, 0x35, 0x24, 0x12, 0xa9, 0xbe, 0xbd, 0xab,
+        0x08, 0x53, 0x35, 0x24, 0x02, 0xa8, 0xdc, 0xcb, 0x9b, 0x09, 0x52, 0x53, 0x33, 0x12, 0xa9, 0xdc,
+        0xac, 0xab, 0x09, 0x42, 0x44, 0x24, 0x02, 0xa0, 0xdb, 0xbc, 0xba, 0x88, 0x42, 0x44, 0x23, 0x13,
+        0xa8, 0xeb, 0xcb, 0xaa, 0x0a, 0x31, 0x45, 0x33, 0x12, 0x90, 0xeb, 0xcb, 0xab, 0x89, 0x31, 0x54,
+        0x33, 0x13, 0x90, 0xdb, 0xbc, 0xac, 0x89, 0x20, 0x44, 0x24, 0x22, 0x80, 0xca, 0xbc, 0xac, 0x8a,
+        0x20, 0x44, 0x43, 0x22, 0x80, 0xba, 0xcd, 0xbb, 0x8a, 0x10, 0x44, 0x34, 0x23, 0x81, 0xba, 0xbe,
+        0xbc, 0x8a, 0x28, 0x53, 0x53, 0x22, 0x81, 0xb9, 0xcc, 0xcb, 0x9a, 0x10, 0x52, 0x43, 0x32, 0x01,
+        0xb9, 0xdc, 0xbb, 0x9b, 0x18, 0x53, 0x34, 0x24, 0x01, 0xb8, 0xeb, 0xbb, 0xab, 0x08, 0x53, 0x34,
+        0x24, 0x02, 0xa8, 0xcc, 0xcb, 0xaa, 0x08, 0x41, 0x34, 0x24, 0x12, 0xa8, 0xdb, 0xbc, 0xab, 0x09,
+        0x42, 0x44, 0x23, 0x13, 0xa8, 0xeb, 0xcb, 0xba, 0x88, 0x31, 0x45, 0x33, 0x12, 0x90, 0xeb, 0xcb,
+        0xab, 0x89, 0x31, 0x54, 0x33, 0x13, 0x90, 0xdb, 0xbc, 0xac, 0x89, 0x20, 0x44, 0x24, 0x22, 0x80,
+        0xca, 0xbc, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x22, 0x80, 0xba, 0xcd, 0xbb, 0x8a, 0x10, 0x44, 0x34,
+        0x23, 0x81, 0xca, 0xbc, 0xad, 0x8a, 0x18, 0x53, 0x43, 0x22, 0x82, 0xb9, 0xcd, 0xbb, 0x9a, 0x18,
+        0x63, 0x43, 0x23, 0x01, 0xb9, 0xbd, 0xad, 0x9a, 0x08, 0x43, 0x34, 0x24, 0x01, 0xb8, 0xeb, 0xbb,
+        0xab, 0x08, 0x53, 0x34, 0x24, 0x02, 0xa8, 0xcc, 0xcb, 0xaa, 0x08, 0x41, 0x34, 0x24, 0x12, 0xa8,
+        0xdb, 0xbc, 0xab, 0x09, 0x42, 0x34, 0x25, 0x02, 0x90, 0xdb, 0xcb, 0xaa, 0x0a, 0x31, 0x45, 0x33,
+        0x12, 0x90, 0xeb, 0xcb, 0xab, 0x89, 0x31, 0x35, 0x25, 0x12, 0x80, 0xcb, 0xbc, 0xac, 0x89, 0x30,
+        0x63, 0x33, 0x23, 0x80, 0xdb, 0xbc, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x22, 0x80, 0xc9, 0xbc, 0xac,
+        0x9a, 0x20, 0x53, 0x34, 0x23, 0x81, 0xca, 0xbc, 0xad, 0x8a, 0x18, 0x53, 0x43, 0x22, 0x82, 0xb9,
+        0xcd, 0xbb, 0x9a, 0x18, 0x63, 0x43, 0x23, 0x01, 0xb9, 0xbd, 0xad, 0x9a, 0x08, 0x43, 0x34, 0x24,
+        0x01, 0xb8, 0xeb, 0xbb, 0xab, 0x08, 0x53, 0x34, 0x24, 0x02, 0xa8, 0xcc, 0xcb, 0xaa, 0x08, 0x41,
+        0x34, 0x24, 0x12, 0xa8, 0xdb, 0xbc, 0xab, 0x09, 0x42, 0x34, 0x25, 0x02, 0x90, 0xdb, 0xcb, 0xaa,
+        0x0a, 0x31, 0x45, 0x33, 0x12, 0x90, 0xeb, 0xcb, 0xab, 0x89, 0x31, 0x35, 0x25, 0x12, 0x80, 0xcb,
+        0xbc, 0xac, 0x89, 0x30, 0x63, 0x33, 0x23, 0x80, 0xdb, 0xbc, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x22,
+        0x80, 0xc9, 0xbc, 0xac, 0x9a, 0x20, 0x53, 0x34, 0x23, 0x81, 0xca, 0xbc, 0xad, 0x8a, 0x18, 0x53,
+        0x43, 0x22, 0x82, 0xb9, 0xcd, 0xbb, 0x9a, 0x18, 0x63, 0x43, 0x23, 0x01, 0xb9, 0xbd, 0xad, 0x9a,
+        0x08, 0x43, 0x34, 0x24, 0x01, 0xb8, 0xeb, 0xbb, 0xab, 0x08, 0x53, 0x34, 0x24, 0x02, 0xa8, 0xcc,
+        0xcb, 0xaa, 0x08, 0x41, 0x34, 0x24, 0x12, 0xa8, 0xdb, 0xbc, 0xab, 0x09, 0x42, 0x34, 0x25, 0x02,
+        0x90, 0xdb, 0xcb, 0xaa, 0x0a, 0x31, 0x45, 0x33, 0x12, 0x90, 0xeb, 0xcb, 0xab, 0x89, 0x31, 0x35,
+        0x25, 0x12, 0x80, 0xcb, 0xbc, 0xac, 0x89, 0x30, 0x63, 0x33, 0x23, 0x80, 0xdb, 0xbc, 0xac, 0x8a,
+        0x20, 0x44, 0x43, 0x22, 0x80, 0xc9, 0xbc, 0xac, 0x9a, 0x20, 0x53, 0x34, 0x23, 0x81, 0xca, 0xbc,
+        0xad, 0x8a, 0x18, 0x53, 0x43, 0x22, 0x82, 0xb9, 0xcd, 0xbb, 0x9a, 0x18, 0x63, 0x43, 0x23, 0x01,
+        0xb9, 0xbd, 0xad, 0x9a, 0x08, 0x43, 0x34, 0x24, 0x01, 0xb8, 0xeb, 0xbb, 0xab, 0x08, 0x53, 0x34,
+        0x24, 0x02, 0xa8, 0xcc, 0xcb, 0xaa, 0x08, 0x41, 0x34, 0x24, 0x12, 0xa8, 0xdb, 0xbc, 0xab, 0x09,
+        0x42, 0x34, 0x25, 0x02, 0x90, 0xdb, 0xcb, 0xaa, 0x0a, 0x31, 0x45, 0x33, 0x12, 0x90, 0xeb, 0xcb,
+        0xab, 0x89, 0x31, 0x35, 0x25, 0x12, 0x80, 0xcb, 0xbc, 0xac, 0x89, 0x30, 0x63, 0x33, 0x23, 0x80,
+        0xdb, 0xbc, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x22, 0x80, 0xc9, 0xbc, 0xac, 0x9a, 0x20, 0x53, 0x34,
+        0x23, 0x81, 0xca, 0xbc, 0xad, 0x8a, 0x18, 0x53, 0x43, 0x22, 0x82, 0xb9, 0xcd, 0xbb, 0x9a, 0x18,
+        0x63, 0x43, 0x23, 0x01, 0xb9, 0xbd, 0xad, 0x9a, 0x08, 0x43, 0x34, 0x24, 0x01, 0xb8, 0xeb, 0xbb,
+        0xab, 0x08, 0x53, 0x34, 0x24, 0x02, 0xa8, 0xcc, 0xcb, 0xaa, 0x08, 0x41, 0x34, 0x24, 0x12, 0xa8,
+        0xdb, 0xbc, 0xab, 0x88, 0x42, 0x34, 0x34, 0x12, 0x98, 0xbc, 0xbd, 0xbb, 0x09, 0x41, 0x44, 0x23,
+        0x13, 0x90, 0xcc, 0xcb, 0xab, 0x0a, 0x30, 0x45, 0x33, 0x13, 0x91, 0xeb, 0xcb, 0xab, 0x89, 0x30,
+        0x44, 0x24, 0x13, 0x91, 0xca, 0xcc, 0xba, 0x89, 0x20, 0x34, 0x35, 0x22, 0x91, 0xc9, 0xcc, 0xba,
+        0x8a, 0x10, 0x44, 0x43, 0x22, 0x81, 0xba, 0xbd, 0xbc, 0x9a, 0x10, 0x34, 0x35, 0x23, 0x01, 0xba,
+        0xcd, 0xbb, 0x9b, 0x18, 0x44, 0x34, 0x23, 0x01, 0xb9, 0xcd, 0xbb, 0x9b, 0x08, 0x34, 0x45, 0x22,
+        0x01, 0xa8, 0xcc, 0xbb, 0xab, 0x18, 0x52, 0x34, 0x24, 0x01, 0xa8, 0xdb, 0xcb, 0xaa, 0x08, 0x32,
+        0x45, 0x32, 0x11, 0xa8, 0xdb, 0xbc, 0xaa, 0x88, 0x32, 0x45, 0x23, 0x12, 0xa0, 0xdb, 0xbc, 0xba,
+        0x09, 0x41, 0x53, 0x33, 0x12, 0x98, 0xdb, 0xcb, 0xab, 0x0a, 0x31, 0x54, 0x23, 0x22, 0x90, 0xdb,
+        0xcb, 0xba, 0x89, 0x21, 0x44, 0x33, 0x23, 0x90, 0xcb, 0xcc, 0xab, 0x89, 0x21, 0x53, 0x33, 0x13,
+        0x80, 0xca, 0xbc, 0xbb, 0x8a, 0x21, 0x34, 0x34, 0x12, 0x90, 0xb9, 0xac, 0x9b, 0x08, 0x11, 0x12,
+        0x41, 0x57, 0xa1, 0xcf, 0x9c, 0x38, 0x46, 0x23, 0xb8, 0xbf, 0xab, 0x30, 0x46, 0x23, 0xb8, 0xcd,
+        0xab, 0x20, 0x36, 0x23, 0xb0, 0xdd, 0xaa, 0x10, 0x35, 0x33, 0xa8, 0xcd, 0xab, 0x18, 0x45, 0x23,
+        0xa0, 0xcc, 0x9c, 0x18, 0x53, 0x23, 0x90, 0xcc, 0xbb, 0x18, 0x54, 0x22, 0x80, 0xbc, 0xac, 0x18,
+        0x43, 0x24, 0x80, 0xdb, 0xab, 0x19, 0x53, 0x33, 0x81, 0xcc, 0xbb, 0x09, 0x63, 0x33, 0x91, 0xda,
+        0xcb, 0x09, 0x42, 0x24, 0x81, 0xba, 0xbd, 0x09, 0x42, 0x24, 0x82, 0xca, 0xac, 0x0a, 0x41, 0x34,
+        0x01, 0xc9, 0xbc, 0x0a, 0x41, 0x34, 0x01, 0xc9, 0xac, 0x9a, 0x32, 0x45, 0x01, 0xb8, 0xcc, 0x99,
+        0x31, 0x34, 0x03, 0xb9, 0xbe, 0x9a, 0x31, 0x35, 0x13, 0xb9, 0xcd, 0x9a, 0x30, 0x44, 0x12, 0xa8,
+        0xbd, 0x9b, 0x30, 0x35, 0x23, 0xb8, 0xcd, 0xaa, 0x20, 0x44, 0x13, 0xa8, 0xbc, 0xac, 0x20, 0x44,
+        0x22, 0xa0, 0xcc, 0x9b, 0x18, 0x44, 0x23, 0xa0, 0xcc, 0xaa, 0x29, 0x63, 0x22, 0x90, 0xcb, 0xac,
+        0x18, 0x53, 0x23, 0x90, 0xdb, 0xbb, 0x19, 0x44, 0x33, 0x91, 0xeb, 0xab, 0x09, 0x53, 0x33, 0x81,
+        0xdb, 0xac, 0x09, 0x42, 0x24, 0x82, 0xcb, 0xac, 0x0a, 0x43, 0x24, 0x82, 0xca, 0xbc, 0x89, 0x42,
+        0x34, 0x01, 0xca, 0xac, 0x8a, 0x42, 0x24, 0x02, 0xc9, 0xbc, 0x8a, 0x32, 0x26, 0x02, 0xb9, 0xbd,
+        0x8a, 0x41, 0x53, 0x11, 0xb9, 0xbc, 0x8b, 0x31, 0x36, 0x12, 0xb9, 0xbd, 0x9b, 0x31, 0x45, 0x12,
+        0xb8, 0xcc, 0x9a, 0x20, 0x35, 0x13, 0xb8, 0xbd, 0xab, 0x30, 0x45, 0x22, 0xa8, 0xcc, 0x9b, 0x20,
+        0x44, 0x22, 0xa8, 0xbc, 0xac, 0x10, 0x44, 0x13, 0x90, 0xcc, 0xab, 0x10, 0x44, 0x22, 0x90, 0xeb,
+        0xaa, 0x18, 0x43, 0x24, 0x90, 0xcb, 0xac, 0x08, 0x53, 0x23, 0x91, 0xdb, 0xbb, 0x19, 0x63, 0x23,
+        0x81, 0xdb, 0xac, 0x08, 0x42, 0x33, 0x92, 0xea, 0xbb, 0x09, 0x43, 0x25, 0x81, 0xca, 0xbb, 0x0a,
+        0x52, 0x34, 0x01, 0xca, 0xbc, 0x89, 0x42, 0x24, 0x02, 0xca, 0xac, 0x8a, 0x41, 0x34, 0x02, 0xba,
+        0xae, 0x8a, 0x31, 0x35, 0x02, 0xc9, 0xdb, 0x99, 0x31, 0x34, 0x03, 0xb9, 0xbe, 0x9a, 0x31, 0x35,
+        0x13, 0xb9, 0xbe, 0x9a, 0x30, 0x35, 0x23, 0xb9, 0xcd, 0x9a, 0x20, 0x44, 0x22, 0xb8, 0xcc, 0x9a,
+        0x28, 0x35, 0x13, 0xb0, 0xcc, 0xab, 0x38, 0x44, 0x23, 0xa0, 0xbd, 0x9c, 0x18, 0x34, 0x14, 0x90,
+        0xdb, 0xab, 0x28, 0x63, 0x22, 0x90, 0xdb, 0xab, 0x18, 0x63, 0x22, 0x91, 0xcb, 0xac, 0x19, 0x53,
+        0x23, 0x91, 0xdb, 0xbb, 0x09, 0x44, 0x33, 0x81, 0xeb, 0xbb, 0x19, 0x52, 0x43, 0x81, 0xca, 0xac,
+        0x09, 0x32, 0x35, 0x81, 0xca, 0xac, 0x0a, 0x42, 0x24, 0x82, 0xc9, 0xbc, 0x89, 0x41, 0x34, 0x82,
+        0xc9, 0xbc, 0x89, 0x41, 0x24, 0x12, 0xba, 0xcd, 0x89, 0x30, 0x44, 0x11, 0xb9, 0xbc, 0x8b, 0x31,
+        0x36, 0x12, 0xb9, 0xbd, 0x9b, 0x31, 0x45, 0x12, 0xb8, 0xcc, 0x9a, 0x20, 0x35, 0x13, 0xb8, 0xbd,
+        0xab, 0x30, 0x45, 0x22, 0xa8, 0xcc, 0x9b, 0x20, 0x34, 0x24, 0xa8, 0xcc, 0xaa, 0x28, 0x44, 0x13,
+        0x90, 0xcc, 0xab, 0x28, 0x44, 0x22, 0xa1, 0xeb, 0xaa, 0x18, 0x43, 0x24, 0x90, 0xdb, 0xab, 0x18,
+        0x53, 0x33, 0x91, 0xcc, 0xbb, 0x19, 0x63, 0x23, 0x81, 0xdb, 0xbb, 0x09, 0x53, 0x24, 0x81, 0xca,
+        0xac, 0x0a, 0x43, 0x24, 0x82, 0xcb, 0xac, 0x0a, 0x42, 0x34, 0x01, 0xca, 0xbc, 0x89, 0x42, 0x24,
+        0x02, 0xca, 0xac, 0x8a, 0x41, 0x34, 0x02, 0xba, 0xae, 0x8a, 0x31, 0x35, 0x02, 0xc9, 0xdb, 0x99,
+        0x31, 0x34, 0x03, 0xb9, 0xbe, 0x9a, 0x31, 0x35, 0x13, 0xb9, 0xcd, 0x9a, 0x30, 0x44, 0x12, 0xa8,
+        0xbd, 0x9b, 0x30, 0x35, 0x23, 0xb8, 0xcd, 0xaa, 0x20, 0x44, 0x13, 0xa8, 0xcc, 0xaa, 0x20, 0x34,
+        0x24, 0x98, 0xcc, 0x9b, 0x18, 0x44, 0x23, 0x98, 0xcc, 0xaa, 0x18, 0x63, 0x22, 0x90, 0xcb, 0xac,
+        0x18, 0x43, 0x24, 0x80, 0xdb, 0xab, 0x19, 0x53, 0x33, 0x91, 0xeb, 0xab, 0x09, 0x53, 0x24, 0x80,
+        0xca, 0xbb, 0x1a, 0x62, 0x33, 0x81, 0xcb, 0xad, 0x09, 0x42, 0x33, 0x82, 0xda, 0xbc, 0x89, 0x42,
+        0x34, 0x01, 0xca, 0xac, 0x8a, 0x42, 0x24, 0x02, 0xc9, 0xbc, 0x8a, 0x32, 0x26, 0x02, 0xb9, 0xbd,
+        0x8a, 0x41, 0x53, 0x11, 0xb9, 0xbc, 0x8b, 0x31, 0x36, 0x12, 0xb9, 0xbd, 0x9b, 0x31, 0x36, 0x12,
+        0xb8, 0xbd, 0xab, 0x31, 0x45, 0x12, 0xa8, 0xcc, 0xaa, 0x30, 0x44, 0x12, 0xa0, 0xbd, 0x9b, 0x38,
+        0x44, 0x23, 0xb0, 0xcc, 0xab, 0x28, 0x35, 0x14, 0x90, 0xbc, 0x9c, 0x18, 0x53, 0x23, 0xa0, 0xeb,
+        0xaa, 0x18, 0x53, 0x13, 0x91, 0xbc, 0xac, 0x19, 0x53, 0x33, 0x80, 0xcc, 0xab, 0x19, 0x53, 0x33,
+        0x91, 0xdb, 0xac, 0x09, 0x43, 0x24, 0x81, 0xcb, 0xbb, 0x0a, 0x63, 0x33, 0x81, 0xda, 0xbb, 0x0a,
+        0x52, 0x24, 0x82, 0xca, 0xcb, 0x89, 0x42, 0x33, 0x83, 0xda, 0xcb, 0x8a, 0x32, 0x26, 0x82, 0xb9,
+        0xbc, 0x9a, 0x42, 0x34, 0x03, 0xba, 0xbe, 0x8a, 0x31, 0x35, 0x12, 0xb9, 0xae, 0x8b, 0x21, 0x35,
+        0x12, 0xb9, 0xcc, 0x9a, 0x30, 0x44, 0x12, 0xa8, 0xbd, 0x9a, 0x20, 0x35, 0x13, 0xb8, 0xdc, 0x9a,
+        0x20, 0x53, 0x22, 0xa8, 0xbc, 0x9c, 0x10, 0x34, 0x23, 0xa0, 0xbd, 0x9c, 0x18, 0x34, 0x14, 0x90,
+        0xbc, 0xab, 0x18, 0x54, 0x22, 0x90, 0xdb, 0xaa, 0x08, 0x34, 0x33, 0xa1, 0xeb, 0xab, 0x19, 0x53,
+        0x23, 0x91, 0xdb, 0xbb, 0x08, 0x53, 0x24, 0x80, 0xca, 0xbb, 0x19, 0x52, 0x33, 0x81, 0xcb, 0xbc,
+        0x09, 0x52, 0x23, 0x01, 0xda, 0xab, 0x89, 0x42, 0x24, 0x01, 0xba, 0xad, 0x89, 0x32, 0x24, 0x02,
+        0xba, 0xad, 0x0a, 0x31, 0x24, 0x02, 0xba, 0xac, 0x8a, 0x22, 0x24, 0x01, 0xa9, 0x9b, 0x09, 0x12,
+    };
+
+    // whirr: 5600 samples, 0.35 s
+    const uint8_t whirr[] = {
+        0x10, 0x31, 0x43, 0x33, 0x36, 0x34, 0x24, 0x34, 0x43, 0x23, 0x34, 0x32, 0x24, 0x22, 0x22, 0x12,
+        0x11, 0x11, 0x99, 0xab, 0xbb, 0x9c, 0xcb, 0xaa, 0xac, 0xcb, 0xaa, 0xcb, 0xa9, 0xbb, 0xbb, 0xbb,
+        0xbb, 0xbb, 0x9c, 0xca, 0xba, 0xbd, 0xcb, 0xbc, 0xcb, 0xcb, 0xbc, 0xca, 0xbb, 0xbc, 0xcb, 0xbb,
+        0xbc, 0xcb, 0xbb, 0xdb, 0xbb, 0xdb, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xac, 0xbc, 0xbc, 0xbc, 0xcb,
+        0xbc, 0xbb, 0xcc, 0xba, 0xbb, 0xac, 0xab, 0xab, 0xaa, 0x09, 0x20, 0x63, 0x44, 0x34, 0x35, 0x35,
+        0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x33, 0x34, 0x43, 0x32, 0x33, 0x24, 0x32, 0x22, 0x23, 0x11,
+        0x11, 0x80, 0xa9, 0xcb, 0xcc, 0xcb, 0xcb, 0xbc, 0xbb, 0xcc, 0xba, 0xbb, 0xbc, 0xca, 0xaa, 0xab,
+        0xbb, 0xbb, 0xcb, 0xba, 0xcb, 0xbb, 0xcb, 0xac, 0xac, 0xbc, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc,
+        0xac, 0xac, 0xab, 0xac, 0xbb, 0xbb, 0xbc, 0xcb, 0xcb, 0xca, 0xbb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbd,
+        0xbc, 0xdb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x08, 0x31, 0x45,
+        0x44, 0x44, 0x34, 0x34, 0x44, 0x33, 0x44, 0x33, 0x53, 0x42, 0x32, 0x42, 0x32, 0x33, 0x33, 0x33,
+        0x24, 0x23, 0x22, 0x11, 0x01, 0x88, 0xaa, 0xbc, 0xbd, 0xcc, 0xbb, 0xcc, 0xba, 0xbc, 0xbb, 0xcb,
+        0xbb, 0xac, 0xab, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xcb, 0xbb, 0xcb, 0xbc, 0xcb, 0xbb, 0xbd, 0xcb,
+        0xbb, 0xad, 0xac, 0xbb, 0xcb, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xac, 0xac, 0xbb, 0xcb, 0xac, 0xbc,
+        0xcb, 0xdb, 0xbb, 0xcc, 0xcb, 0xcb, 0xbb, 0xbd, 0xbb, 0xcc, 0xba, 0xcb, 0xab, 0xbb, 0xbb, 0xaa,
+        0x9a, 0x00, 0x41, 0x54, 0x34, 0x45, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x42, 0x22,
+        0x33, 0x43, 0x32, 0x32, 0x33, 0x22, 0x23, 0x11, 0x01, 0x98, 0xb9, 0xcc, 0xbc, 0xbc, 0xbd, 0xbb,
+        0xbd, 0xbb, 0xdb, 0xba, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xac, 0xab, 0xbb, 0xcb, 0xba, 0xac, 0xcb,
+        0xbb, 0xbc, 0xbc, 0xdb, 0xca, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xac, 0xcb,
+        0xba, 0xbc, 0xbb, 0xbd, 0xdb, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xcb,
+        0xba, 0xba, 0xba, 0xaa, 0x9a, 0x00, 0x41, 0x44, 0x44, 0x44, 0x53, 0x33, 0x35, 0x53, 0x33, 0x53,
+        0x33, 0x43, 0x33, 0x34, 0x43, 0x32, 0x23, 0x24, 0x22, 0x22, 0x12, 0x11, 0x01, 0x98, 0xa9, 0xcb,
+        0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xbc, 0xba, 0xac, 0xba, 0xba, 0xbb, 0xbb,
+        0xac, 0xbb, 0xbc, 0xbb, 0xad, 0xac, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xcb, 0xba,
+        0xbb, 0xac, 0xbb, 0xac, 0xcb, 0xba, 0xac, 0xbc, 0xcb, 0xcb, 0xbc, 0xbc, 0xdb, 0xcb, 0xbb, 0xcc,
+        0xbb, 0xcb, 0xcb, 0xba, 0xcb, 0xba, 0xaa, 0xaa, 0x99, 0x18, 0x31, 0x55, 0x53, 0x34, 0x35, 0x34,
+        0x34, 0x44, 0x42, 0x42, 0x32, 0x43, 0x32, 0x24, 0x33, 0x43, 0x32, 0x23, 0x33, 0x32, 0x22, 0x21,
+        0x00, 0x90, 0xb9, 0xbc, 0xcd, 0xbb, 0xbd, 0xdb, 0xba, 0xac, 0xbb, 0xac, 0xbb, 0xcb, 0xba, 0xba,
+        0xbb, 0xac, 0xba, 0xab, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xac, 0xcb,
+        0xbb, 0xbb, 0xad, 0xbb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xdb, 0xbb, 0xcc,
+        0xbb, 0xbd, 0xcb, 0xcb, 0xac, 0xcb, 0xbb, 0xcb, 0xba, 0xac, 0xba, 0xaa, 0xa9, 0x88, 0x20, 0x53,
+        0x54, 0x53, 0x53, 0x43, 0x43, 0x43, 0x24, 0x34, 0x33, 0x34, 0x24, 0x24, 0x33, 0x33, 0x43, 0x23,
+        0x33, 0x23, 0x23, 0x22, 0x11, 0x00, 0x99, 0xcb, 0xdb, 0xbc, 0xbc, 0xcc, 0xba, 0xbc, 0xbb, 0xbc,
+        0xbb, 0xcb, 0xbb, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xac, 0xbb, 0xac, 0xcb, 0xbb, 0xbc, 0xbc, 0xac,
+        0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xac, 0xbb, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xac, 0xcb,
+        0xcb, 0xcb, 0xcb, 0xdb, 0xbb, 0xbc, 0xbd, 0xcb, 0xbb, 0xad, 0xac, 0xbb, 0xcb, 0xba, 0xbb, 0xbb,
+        0xab, 0x99, 0x08, 0x42, 0x45, 0x44, 0x34, 0x44, 0x34, 0x53, 0x33, 0x44, 0x42, 0x32, 0x24, 0x33,
+        0x34, 0x33, 0x43, 0x23, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0x88, 0xba, 0xcc, 0xbc, 0xbd, 0xdb,
+        0xbb, 0xdb, 0xba, 0xac, 0xbb, 0xbb, 0xbc, 0xba, 0xcb, 0xaa, 0xbb, 0xba, 0xcb, 0xba, 0xcb, 0xca,
+        0xba, 0xac, 0xbc, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xac,
+        0xac, 0xbb, 0xcb, 0xcb, 0xcb, 0xbc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcc, 0xca, 0xba, 0xac, 0xcb,
+        0xba, 0xcb, 0xaa, 0xab, 0x9b, 0x9a, 0x88, 0x31, 0x54, 0x44, 0x34, 0x35, 0x44, 0x43, 0x43, 0x33,
+        0x25, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x32, 0x23, 0x33, 0x22, 0x21, 0x01, 0x88, 0xa9,
+        0xbc, 0xbd, 0xcc, 0xbb, 0xbd, 0xbb, 0xcc, 0xba, 0xbb, 0xac, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xbb,
+        0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xdb, 0xbb, 0xbc, 0xdb, 0xbb, 0xdb, 0xbb, 0xcb, 0xcb, 0xba, 0xac,
+        0xbb, 0xcb, 0xbb, 0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xcc, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xbc, 0xcb,
+        0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x31, 0x45, 0x45, 0x53, 0x53,
+        0x43, 0x43, 0x43, 0x34, 0x33, 0x35, 0x33, 0x34, 0x43, 0x33, 0x33, 0x34, 0x32, 0x33, 0x33, 0x22,
+        0x22, 0x01, 0x80, 0xaa, 0xdb, 0xbc, 0xbd, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xca, 0xba, 0xba,
+        0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xbc, 0xac, 0xcb, 0xbb, 0xbc, 0xbc, 0xdb, 0xca, 0xba, 0xac,
+        0xcb, 0xbb, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbc,
+        0xdb, 0xbb, 0xcc, 0xbb, 0xad, 0xac, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0x9a, 0x89, 0x31,
+        0x64, 0x53, 0x44, 0x43, 0x34, 0x44, 0x33, 0x44, 0x42, 0x32, 0x34, 0x33, 0x43, 0x43, 0x32, 0x33,
+        0x33, 0x33, 0x33, 0x33, 0x12, 0x02, 0x80, 0xb9, 0xdb, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcb,
+        0xcb, 0xba, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xac, 0xba, 0xbb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbd, 0xcb,
+        0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb,
+        0xcb, 0xcb, 0xcb, 0xbc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xac, 0xac, 0xba, 0xba,
+        0xaa, 0x9a, 0x88, 0x11, 0x44, 0x54, 0x43, 0x44, 0x43, 0x34, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33,
+        0x43, 0x33, 0x34, 0x32, 0x33, 0x24, 0x22, 0x22, 0x11, 0x01, 0x80, 0xa8, 0xca, 0xcb, 0xbc, 0xbd,
+        0xcb, 0xbb, 0xbc, 0xac, 0xcb, 0xba, 0xab, 0xac, 0xba, 0xab, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xbc,
+        0xbb, 0xad, 0xac, 0xbb, 0xcc, 0xba, 0xbc, 0xcb, 0xbb, 0xdb, 0xba, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb,
+        0xcb, 0xbb, 0xcb, 0xbb, 0xcc, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xac, 0xac, 0xcb, 0xba,
+        0xac, 0xbb, 0xbb, 0xbb, 0xac, 0x99, 0x89, 0x20, 0x53, 0x44, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43,
+        0x33, 0x44, 0x32, 0x24, 0x33, 0x24, 0x33, 0x43, 0x32, 0x32, 0x22, 0x23, 0x21, 0x11, 0x08, 0x99,
+        0xcb, 0xdb, 0xcb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xac,
+        0xbb, 0xbb, 0xcb, 0xca, 0xba, 0xbb, 0xcc, 0xca, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc,
+        0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xcb, 0xac, 0xbc, 0xdb, 0xbb, 0xcc, 0xbb,
+        0xcc, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xab, 0x89, 0x10, 0x63, 0x44, 0x34, 0x45,
+        0x43, 0x53, 0x33, 0x34, 0x34, 0x34, 0x43, 0x43, 0x32, 0x43, 0x32, 0x33, 0x24, 0x23, 0x32, 0x22,
+        0x22, 0x11, 0x00, 0x89, 0xba, 0xcc, 0xbc, 0xbc, 0xcc, 0xca, 0xba, 0xcb, 0xab, 0xac, 0xbb, 0xbb,
+        0xbb, 0xbc, 0xba, 0xbb, 0xbb, 0xbc, 0xca, 0xaa, 0xcb, 0xba, 0xbc, 0xcb, 0xbb, 0xad, 0xac, 0xbb,
+        0xbc, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xbc, 0xcb, 0xbc,
+        0xdb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcc, 0xbb, 0xcb, 0xbb, 0xcb, 0xab, 0xbb, 0xaa, 0x9a, 0x09,
+        0x22, 0x55, 0x53, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x34, 0x34, 0x33, 0x34, 0x24, 0x43, 0x32,
+        0x32, 0x33, 0x33, 0x32, 0x23, 0x22, 0x01, 0x80, 0xa9, 0xbc, 0xbd, 0xbd, 0xbc, 0xcb, 0xbc, 0xbb,
+        0xbc, 0xcb, 0xba, 0xcb, 0xba, 0xba, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbc,
+        0xcb, 0xcb, 0xcb, 0xcb, 0xca, 0xba, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb,
+        0xbd, 0xcb, 0xcb, 0xdb, 0xbb, 0xcc, 0xbb, 0xbd, 0xdb, 0xca, 0xca, 0xba, 0xcb, 0xbb, 0xbb, 0xbc,
+        0xbb, 0xba, 0xaa, 0x99, 0x10, 0x34, 0x46, 0x34, 0x35, 0x35, 0x34, 0x34, 0x44, 0x42, 0x32, 0x34,
+        0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x32, 0x32, 0x32, 0x21, 0x11, 0x81, 0x98, 0xba, 0xbd, 0xbd,
+        0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xbc, 0xca,
+        0xba, 0xcb, 0xbb, 0xad, 0xac, 0xcb, 0xbb, 0xcc, 0xba, 0xbc, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xcb,
+        0xba, 0xca, 0xba, 0xcb, 0xca, 0xbb, 0xbc, 0xcc, 0xbb, 0xbd, 0xbc, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc,
+        0xcb, 0xcb, 0xab, 0xcb, 0xaa, 0xab, 0x9a, 0x99, 0x18, 0x32, 0x46, 0x63, 0x43, 0x34, 0x34, 0x44,
+        0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x24, 0x43, 0x32, 0x32, 0x23, 0x33, 0x23, 0x23, 0x11, 0x01,
+        0x98, 0xba, 0xbd, 0xbd, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb,
+        0xbb, 0xac, 0xbb, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xac,
+        0xac, 0xbb, 0xbb, 0xbc, 0xbb, 0xac, 0xac, 0xbb, 0xdb, 0xca, 0xca, 0xbb, 0xbc, 0xcc, 0xcb, 0xcb,
+        0xcb, 0xcb, 0xbb, 0xad, 0xcb, 0xba, 0xac, 0xbb, 0xba, 0xbb, 0xaa, 0x9a, 0x18, 0x42, 0x54, 0x44,
+        0x53, 0x53, 0x33, 0x35, 0x53, 0x33, 0x53, 0x33, 0x43, 0x43, 0x32, 0x43, 0x32, 0x33, 0x33, 0x33,
+        0x23, 0x23, 0x12, 0x81, 0x90, 0xba, 0xcd, 0xcb, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xac, 0xab,
+        0xcb, 0xaa, 0xab, 0xbb, 0xbb, 0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xcb,
+        0xbb, 0xbc, 0xcb, 0xcb, 0xba, 0xcb, 0xab, 0xcb, 0xba, 0xcb, 0xba, 0xcb, 0xca, 0xca, 0xca, 0xca,
+        0xca, 0xbb, 0xcc, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xbb, 0xac, 0xac, 0xab, 0xbb, 0xbb, 0xaa, 0x9a,
+        0x00, 0x41, 0x54, 0x34, 0x45, 0x43, 0x34, 0x53, 0x43, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x33,
+        0x43, 0x23, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0x98, 0xba, 0xcc, 0xbc, 0xbd, 0xdb, 0xbb, 0xcb,
+        0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xcb, 0xab, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xac, 0xcb, 0xbb, 0xdb,
+        0xbb, 0xdb, 0xbb, 0xbc, 0xcb, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xac, 0xbb, 0xca, 0xba, 0xbb, 0xbc,
+        0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xbc, 0xdb, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba,
+        0xab, 0xbb, 0xab, 0x99, 0x08, 0x41, 0x44, 0x54, 0x43, 0x44, 0x33, 0x35, 0x34, 0x53, 0x33, 0x43,
+        0x43, 0x33, 0x43, 0x33, 0x43, 0x23, 0x33, 0x23, 0x33, 0x22, 0x12, 0x01, 0x98, 0xb9, 0xcc, 0xdb,
+        0xcb, 0xcb, 0xac, 0xcb, 0xbb, 0xcb, 0xca, 0xaa, 0xbb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xcb,
+        0xbb, 0xac, 0xac, 0xcb, 0xca, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb, 0xbb,
+        0xbc, 0xca, 0xba, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xac, 0xbc, 0xbc, 0xdb, 0xbb, 0xbd, 0xcb, 0xbb,
+        0xbc, 0xbc, 0xbb, 0xbc, 0xba, 0xbb, 0xab, 0xa9, 0x08, 0x41, 0x63, 0x44, 0x53, 0x53, 0x33, 0x35,
+        0x53, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x33, 0x23, 0x33, 0x22, 0x12, 0x11,
+        0x88, 0xaa, 0xbc, 0xcd, 0xbb, 0xbd, 0xbc, 0xbb, 0xad, 0xcb, 0xba, 0xbb, 0xbb, 0xbc, 0xbb, 0xca,
+        0xaa, 0xbb, 0xba, 0xcb, 0xba, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcc, 0xca, 0xba, 0xcb, 0xbb, 0xbc,
+        0xcb, 0xba, 0xac, 0xbb, 0xca, 0xba, 0xbb, 0xcb, 0xcb, 0xca, 0xba, 0xbc, 0xbc, 0xbc, 0xcc, 0xbb,
+        0xcc, 0xbb, 0xcc, 0xbb, 0xcb, 0xac, 0xbb, 0xac, 0xbb, 0xba, 0xab, 0x9a, 0x09, 0x20, 0x54, 0x44,
+        0x34, 0x35, 0x44, 0x43, 0x43, 0x43, 0x33, 0x44, 0x32, 0x24, 0x33, 0x24, 0x33, 0x33, 0x24, 0x23,
+        0x23, 0x22, 0x12, 0x11, 0x80, 0x99, 0xbb, 0xcd, 0xcb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb,
+        0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xcb, 0xab, 0xbb, 0xac, 0xcb, 0xba, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc,
+        0xcb, 0xac, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xad,
+        0xac, 0xbc, 0xcb, 0xbc, 0xbc, 0xbc, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xaa, 0xaa,
+        0x89, 0x18, 0x41, 0x44, 0x44, 0x34, 0x35, 0x34, 0x44, 0x33, 0x34, 0x34, 0x34, 0x33, 0x34, 0x34,
+        0x42, 0x22, 0x33, 0x32, 0x33, 0x23, 0x32, 0x11, 0x01, 0x90, 0xaa, 0xbd, 0xcc, 0xcb, 0xdb, 0xca,
+        0xba, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xcb, 0xba, 0xbb, 0xbb, 0xcb, 0xba, 0xbb, 0xbc, 0xbb, 0xad,
+        0xac, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xac, 0xcb, 0xba, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb,
+        0xbb, 0xbc, 0xcb, 0xbc, 0xdb, 0xbb, 0xbd, 0xdb, 0xbb, 0xcc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xbb,
+        0xcb, 0xba, 0xbb, 0xaa, 0xaa, 0x88, 0x21, 0x54, 0x44, 0x44, 0x43, 0x34, 0x35, 0x43, 0x43, 0x43,
+        0x43, 0x33, 0x43, 0x43, 0x32, 0x33, 0x24, 0x33, 0x23, 0x33, 0x22, 0x22, 0x01, 0x80, 0x99, 0xdb,
+        0xcb, 0xcc, 0xbb, 0xcc, 0xca, 0xba, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbb, 0xac, 0xab, 0xbb, 0xcb,
+        0xba, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xcc, 0xca, 0xba, 0xcb, 0xbb, 0xcb, 0xcb, 0xba,
+        0xac, 0xab, 0xcb, 0xba, 0xac, 0xbb, 0xbc, 0xbc, 0xbc, 0xcc, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb,
+        0xbb, 0xcc, 0xba, 0xcb, 0xba, 0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x11, 0x43, 0x45, 0x44, 0x53, 0x43,
+        0x34, 0x53, 0x33, 0x34, 0x34, 0x43, 0x33, 0x34, 0x43, 0x32, 0x43, 0x22, 0x23, 0x23, 0x22, 0x12,
+        0x11, 0x80, 0x98, 0xbb, 0xcd, 0xcb, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xbb, 0xbb,
+        0xcb, 0xba, 0xbb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb,
+        0xbc, 0xbb, 0xbc, 0xac, 0xbb, 0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xbc, 0xdb,
+        0xbb, 0xcc, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xba, 0xbb, 0xbb, 0xab, 0x9b, 0x8a, 0x20, 0x63,
+        0x44, 0x44, 0x34, 0x44, 0x43, 0x43, 0x24, 0x24, 0x24, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x33,
+        0x32, 0x33, 0x32, 0x22, 0x11, 0x00, 0x99, 0xcb, 0xbc, 0xbd, 0xcc, 0xca, 0xbb, 0xcb, 0xcb, 0xba,
+        0xcb, 0xba, 0xbb, 0xbb, 0xac, 0xbb, 0xab, 0xac, 0xba, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xdb, 0xbb,
+        0xbc, 0xcb, 0xac, 0xac, 0xbb, 0xcb, 0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xac, 0xbb, 0xbc, 0xcb, 0xbb,
+        0xbd, 0xcb, 0xbc, 0xdb, 0xcb, 0xbb, 0xbd, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa,
+        0x9a, 0x89, 0x10, 0x53, 0x44, 0x35, 0x44, 0x43, 0x34, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x43,
+        0x33, 0x24, 0x33, 0x33, 0x33, 0x33, 0x23, 0x22, 0x02, 0x81, 0xa9, 0xda, 0xdb, 0xcb, 0xdb, 0xca,
+        0xba, 0xbc, 0xca, 0xba, 0xbb, 0xac, 0xbb, 0xbb, 0xac, 0xab, 0xbb, 0xbb, 0xbb, 0xbc, 0xbb, 0xbc,
+        0xbc, 0xcb, 0xbb, 0xbd, 0xbb, 0xad, 0xac, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xac, 0xcb, 0xba, 0xbb,
+        0xcb, 0xbb, 0xdb, 0xbb, 0xbc, 0xbc, 0xcc, 0xbb, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xbb,
+        0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x10, 0x44, 0x45, 0x34, 0x35, 0x44, 0x43, 0x34, 0x43, 0x43,
+        0x33, 0x34, 0x34, 0x33, 0x34, 0x33, 0x43, 0x32, 0x33, 0x32, 0x32, 0x12, 0x02, 0x81, 0x99, 0xca,
+        0xbc, 0xbd, 0xdb, 0xbb, 0xad, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0xbc,
+        0xba, 0xac, 0xab, 0xac, 0xcb, 0xba, 0xbc, 0xcb, 0xcb, 0xbb, 0xbc, 0xac, 0xac, 0xbb, 0xcb, 0xab,
+        0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbd, 0xcb, 0xbc, 0xcb,
+        0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xcb, 0xab, 0xba, 0x9a, 0x99, 0x10, 0x53, 0x44, 0x44, 0x34, 0x44,
+        0x43, 0x43, 0x34, 0x33, 0x35, 0x33, 0x34, 0x24, 0x43, 0x32, 0x32, 0x33, 0x33, 0x33, 0x33, 0x22,
+        0x12, 0x00, 0xa8, 0xbb, 0xbe, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xcb, 0xba, 0xbb, 0xac, 0xbb,
+        0xba, 0xcb, 0xaa, 0xab, 0xbb, 0xcb, 0xba, 0xcb, 0xca, 0xba, 0xcb, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb,
+        0xbb, 0xac, 0xac, 0xab, 0xcb, 0xba, 0xbb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb, 0xbc, 0xcb, 0xbc, 0xdb,
+        0xcb, 0xbb, 0xbd, 0xcb, 0xac, 0xac, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xab, 0xaa, 0x8a, 0x18, 0x42,
+        0x54, 0x44, 0x53, 0x43, 0x53, 0x33, 0x44, 0x33, 0x34, 0x24, 0x24, 0x33, 0x24, 0x33, 0x43, 0x32,
+        0x32, 0x23, 0x23, 0x22, 0x12, 0x81, 0x90, 0xba, 0xeb, 0xcb, 0xbc, 0xdb, 0xca, 0xba, 0xac, 0xbb,
+        0xcb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xbc, 0xcb, 0xcb, 0xcb,
+        0xca, 0xba, 0xbc, 0xcb, 0xbb, 0xcb, 0xcb, 0xab, 0xac, 0xba, 0xcb, 0xba, 0xbb, 0xcb, 0xcb, 0xbb,
+        0xbc, 0xbc, 0xbc, 0xbc, 0xcc, 0xbb, 0xcc, 0xbb, 0xad, 0xac, 0xbb, 0xbc, 0xcb, 0xba, 0xbb, 0xcb,
+        0x9a, 0x9a, 0x88, 0x20, 0x63, 0x53, 0x44, 0x43, 0x34, 0x34, 0x44, 0x33, 0x34, 0x34, 0x43, 0x33,
+        0x43, 0x43, 0x32, 0x33, 0x33, 0x33, 0x33, 0x23, 0x23, 0x11, 0x80, 0xa9, 0xbc, 0xbd, 0xbd, 0xdb,
+        0xbb, 0xbc, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xac, 0xcb, 0xba,
+        0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xac, 0xac, 0xbb, 0xbc, 0xcb, 0xbb, 0xac, 0xcb, 0xba, 0xbb, 0xcb,
+        0xbb, 0xac, 0xcb, 0xbb, 0xbc, 0xdb, 0xbb, 0xbd, 0xdb, 0xbb, 0xcc, 0xbb, 0xbc, 0xcc, 0xba, 0xac,
+        0xbb, 0xbc, 0xab, 0xcb, 0xaa, 0xa9, 0x89, 0x10, 0x42, 0x44, 0x35, 0x44, 0x34, 0x34, 0x34, 0x44,
+        0x42, 0x32, 0x24, 0x24, 0x33, 0x33, 0x34, 0x33, 0x33, 0x24, 0x23, 0x22, 0x22, 0x11, 0x00, 0x99,
+        0xba, 0xbd, 0xcc, 0xcb, 0xac, 0xac, 0xcb, 0xba, 0xcb, 0xab, 0xcb, 0xba, 0xab, 0xbb, 0xac, 0xab,
+        0xbb, 0xbb, 0xac, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xcc, 0xba, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xab,
+        0xac, 0xcb, 0xaa, 0xbb, 0xcb, 0xba, 0xac, 0xcb, 0xbb, 0xdb, 0xbb, 0xbd, 0xdb, 0xbb, 0xad, 0xbc,
+        0xcb, 0xcb, 0xca, 0xab, 0xbc, 0xba, 0xcb, 0xba, 0xaa, 0x9a, 0x99, 0x20, 0x42, 0x45, 0x44, 0x53,
+        0x43, 0x43, 0x34, 0x43, 0x43, 0x43, 0x33, 0x34, 0x33, 0x34, 0x33, 0x43, 0x23, 0x33, 0x23, 0x23,
+        0x22, 0x11, 0x80, 0xa9, 0xcb, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xcb, 0xba, 0xac, 0xbb, 0xbb, 0xcb,
+        0xbb, 0xbb, 0xbb, 0xbc, 0xba, 0xbb, 0xac, 0xbb, 0xcb, 0xbb, 0xbc, 0xac, 0xbc, 0xca, 0xbb, 0xcb,
+        0xcb, 0xbb, 0xcb, 0xca, 0xaa, 0xbb, 0xbb, 0xac, 0xbb, 0xbb, 0xac, 0xcb, 0xba, 0xad, 0xcb, 0xca,
+        0xca, 0xbb, 0xcc, 0xca, 0xbb, 0xdb, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xab, 0xba, 0x19, 0x41, 0x32,
+        0x37, 0x53, 0x53, 0x33, 0x35, 0x43, 0x43, 0x33, 0x34, 0x33, 0x34, 0x24, 0x23, 0x33, 0x23, 0x33,
+        0x22, 0x22, 0x00, 0x90, 0xbb, 0xcb, 0xbb, 0xbd, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xba, 0xcb,
+    };
+
+    // boot: 4800 samples, 0.30 s
+    const uint8_t boot[] = {
+        0x70, 0x56, 0x44, 0x43, 0x23, 0x13, 0x80, 0xdb, 0xcd, 0xbd, 0xcc, 0xbb, 0xbc, 0xba, 0x9a, 0x08,
+        0x42, 0x45, 0x44, 0x53, 0x42, 0x32, 0x32, 0x22, 0x01, 0x98, 0xcc, 0xdc, 0xcb, 0xcb, 0xcb, 0xba,
+        0xab, 0x9a, 0x08, 0x32, 0x45, 0x35, 0x34, 0x34, 0x34, 0x32, 0x12, 0x11, 0xa8, 0xdb, 0xdc, 0xcb,
+        0xcb, 0xbb, 0xbb, 0xbb, 0x9a, 0x08, 0x43, 0x45, 0x44, 0x33, 0x44, 0x32, 0x22, 0x12, 0x81, 0xb8,
+        0xcc, 0xcc, 0xbc, 0xbc, 0xbb, 0xbb, 0xaa, 0x89, 0x20, 0x54, 0x34, 0x35, 0x34, 0x43, 0x32, 0x12,
+        0x01, 0x98, 0xcb, 0xcd, 0xcb, 0xac, 0xac, 0xaa, 0xaa, 0x89, 0x10, 0x43, 0x44, 0x34, 0x44, 0x32,
+        0x32, 0x12, 0x01, 0x98, 0xdb, 0xcc, 0xdb, 0xbb, 0xcb, 0xba, 0x9a, 0x09, 0x20, 0x44, 0x34, 0x35,
+        0x43, 0x33, 0x33, 0x12, 0x81, 0xba, 0xcd, 0xcc, 0xcb, 0xcb, 0xba, 0xaa, 0x99, 0x00, 0x42, 0x44,
+        0x53, 0x33, 0x34, 0x23, 0x13, 0x01, 0xa8, 0xcc, 0xcc, 0xbc, 0xbb, 0xbc, 0xab, 0x8a, 0x08, 0x32,
+        0x36, 0x35, 0x44, 0x32, 0x32, 0x22, 0x81, 0xa8, 0xcc, 0xbc, 0xbd, 0xac, 0xbb, 0xab, 0x99, 0x10,
+        0x42, 0x45, 0x43, 0x43, 0x23, 0x23, 0x12, 0x91, 0xb9, 0xcd, 0xcc, 0xbb, 0xcb, 0xab, 0xaa, 0x88,
+        0x21, 0x54, 0x43, 0x34, 0x43, 0x32, 0x12, 0x01, 0x99, 0xbc, 0xcd, 0xcb, 0xbb, 0xbb, 0xab, 0x8a,
+        0x20, 0x44, 0x44, 0x34, 0x43, 0x23, 0x13, 0x11, 0xa8, 0xcb, 0xcd, 0xcb, 0xbb, 0xac, 0xaa, 0x89,
+        0x11, 0x43, 0x44, 0x34, 0x24, 0x33, 0x12, 0x01, 0xa8, 0xdb, 0xcc, 0xac, 0xac, 0xba, 0xa9, 0x88,
+        0x21, 0x34, 0x45, 0x43, 0x32, 0x23, 0x22, 0x80, 0xc9, 0xdb, 0xcc, 0xca, 0xba, 0xaa, 0x89, 0x18,
+        0x41, 0x44, 0x43, 0x43, 0x32, 0x12, 0x01, 0x98, 0xbc, 0xcd, 0xcb, 0xba, 0xbb, 0x9a, 0x09, 0x32,
+        0x45, 0x44, 0x33, 0x43, 0x22, 0x01, 0x98, 0xca, 0xbd, 0xbc, 0xbc, 0xba, 0x9a, 0x09, 0x22, 0x45,
+        0x53, 0x33, 0x24, 0x22, 0x11, 0xa8, 0xda, 0xdb, 0xcb, 0xbb, 0xab, 0x9b, 0x08, 0x42, 0x44, 0x34,
+        0x34, 0x33, 0x22, 0x01, 0xa9, 0xdc, 0xdb, 0xbb, 0xbc, 0xaa, 0x89, 0x18, 0x43, 0x35, 0x44, 0x32,
+        0x23, 0x12, 0x80, 0xca, 0xcc, 0xbc, 0xcb, 0xba, 0x9a, 0x88, 0x22, 0x45, 0x53, 0x42, 0x22, 0x12,
+        0x00, 0xa9, 0xdb, 0xbc, 0xbc, 0xbb, 0xab, 0x0a, 0x30, 0x54, 0x53, 0x43, 0x32, 0x22, 0x01, 0xa8,
+        0xdb, 0xcc, 0xcb, 0xba, 0xaa, 0x99, 0x11, 0x34, 0x36, 0x43, 0x33, 0x23, 0x01, 0xa8, 0xeb, 0xbc,
+        0xbc, 0xac, 0xaa, 0x89, 0x11, 0x53, 0x44, 0x33, 0x33, 0x23, 0x01, 0xb9, 0xec, 0xcb, 0xcb, 0xba,
+        0x9a, 0x09, 0x21, 0x35, 0x35, 0x34, 0x23, 0x12, 0x91, 0xc9, 0xcc, 0xcb, 0xac, 0xaa, 0x9a, 0x00,
+        0x33, 0x36, 0x44, 0x32, 0x22, 0x01, 0x98, 0xdb, 0xcc, 0xbb, 0xcb, 0x9a, 0x09, 0x21, 0x44, 0x34,
+        0x34, 0x23, 0x12, 0x80, 0xca, 0xbd, 0xcc, 0xba, 0xaa, 0x8a, 0x20, 0x53, 0x44, 0x33, 0x24, 0x12,
+        0x81, 0xb9, 0xbd, 0xbd, 0xcb, 0xaa, 0x8a, 0x18, 0x43, 0x35, 0x34, 0x33, 0x23, 0x00, 0xc9, 0xeb,
+        0xcb, 0xbb, 0x9c, 0x8a, 0x18, 0x33, 0x36, 0x34, 0x43, 0x21, 0x80, 0xa9, 0xcc, 0xbc, 0xcb, 0xaa,
+        0x8a, 0x10, 0x53, 0x34, 0x34, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xbd, 0xbb, 0xba, 0x09, 0x21, 0x45,
+        0x34, 0x43, 0x23, 0x11, 0x98, 0xdb, 0xbc, 0xbc, 0xac, 0x99, 0x08, 0x32, 0x54, 0x43, 0x32, 0x22,
+        0x81, 0xb9, 0xdc, 0xdb, 0xba, 0xaa, 0x89, 0x20, 0x44, 0x53, 0x33, 0x23, 0x12, 0xa8, 0xdb, 0xbd,
+        0xbc, 0xba, 0x9a, 0x00, 0x43, 0x35, 0x25, 0x33, 0x21, 0x90, 0xc9, 0xcc, 0xcb, 0xab, 0x9b, 0x08,
+        0x41, 0x63, 0x33, 0x24, 0x22, 0x80, 0xa9, 0xcd, 0xcb, 0xab, 0xab, 0x09, 0x31, 0x45, 0x34, 0x33,
+        0x23, 0x01, 0xc9, 0xcc, 0xdb, 0xba, 0xaa, 0x09, 0x21, 0x35, 0x35, 0x43, 0x12, 0x81, 0xa9, 0xcc,
+        0xbc, 0xcb, 0x9a, 0x88, 0x31, 0x44, 0x34, 0x43, 0x12, 0x80, 0xb9, 0xdc, 0xbb, 0xac, 0xaa, 0x08,
+        0x42, 0x34, 0x25, 0x33, 0x12, 0x90, 0xca, 0xbd, 0xbc, 0xbb, 0x9a, 0x10, 0x63, 0x53, 0x33, 0x32,
+        0x11, 0xa8, 0xcc, 0xcc, 0xbb, 0xaa, 0x89, 0x21, 0x45, 0x43, 0x33, 0x13, 0x81, 0xc9, 0xcc, 0xbc,
+        0xab, 0xaa, 0x00, 0x43, 0x35, 0x34, 0x14, 0x02, 0x98, 0xcb, 0xcc, 0xbb, 0xaa, 0x89, 0x31, 0x45,
+        0x43, 0x33, 0x13, 0x80, 0xca, 0xbd, 0xad, 0xab, 0x99, 0x10, 0x53, 0x34, 0x24, 0x23, 0x00, 0xb9,
+        0xcc, 0xcc, 0xaa, 0x9a, 0x08, 0x42, 0x44, 0x33, 0x23, 0x02, 0xb8, 0xdc, 0xdb, 0xba, 0x9a, 0x19,
+        0x41, 0x53, 0x24, 0x23, 0x11, 0xa8, 0xdb, 0xbc, 0xac, 0x9b, 0x09, 0x32, 0x45, 0x43, 0x32, 0x11,
+        0x98, 0xbc, 0xcd, 0xba, 0xaa, 0x08, 0x31, 0x45, 0x24, 0x23, 0x02, 0xa8, 0xdb, 0xbc, 0xbc, 0x9a,
+        0x19, 0x41, 0x44, 0x33, 0x33, 0x11, 0xb9, 0xdc, 0xbc, 0xbb, 0x9b, 0x18, 0x53, 0x44, 0x33, 0x23,
+        0x01, 0xc9, 0xcc, 0xcb, 0xab, 0x8a, 0x28, 0x44, 0x53, 0x23, 0x12, 0x91, 0xca, 0xcc, 0xbb, 0xbb,
+        0x09, 0x31, 0x36, 0x35, 0x32, 0x11, 0xa8, 0xcc, 0xdb, 0xab, 0x9a, 0x08, 0x43, 0x35, 0x43, 0x22,
+        0x00, 0xba, 0xcd, 0xbb, 0xac, 0x09, 0x20, 0x44, 0x24, 0x33, 0x02, 0x98, 0xcc, 0xbc, 0xcb, 0x8a,
+        0x08, 0x43, 0x34, 0x34, 0x13, 0x91, 0xba, 0xce, 0xbb, 0xaa, 0x89, 0x32, 0x45, 0x34, 0x32, 0x01,
+        0xa9, 0xcd, 0xbb, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x33, 0x12, 0xa8, 0xeb, 0xdb, 0xba, 0x99, 0x18,
+        0x43, 0x44, 0x33, 0x12, 0x90, 0xcb, 0xbd, 0xac, 0xaa, 0x18, 0x32, 0x36, 0x34, 0x12, 0x91, 0xc9,
+        0xcc, 0xbb, 0xaa, 0x09, 0x42, 0x35, 0x34, 0x22, 0x80, 0xba, 0xcd, 0xac, 0xaa, 0x88, 0x32, 0x45,
+        0x33, 0x13, 0x81, 0xca, 0xcc, 0xcb, 0xaa, 0x08, 0x41, 0x53, 0x33, 0x23, 0x80, 0xca, 0xbd, 0xbc,
+        0xaa, 0x08, 0x42, 0x44, 0x33, 0x13, 0x91, 0xcb, 0xbd, 0xbc, 0x9a, 0x18, 0x52, 0x53, 0x32, 0x12,
+        0x90, 0xdb, 0xbc, 0xbb, 0x9a, 0x28, 0x44, 0x44, 0x32, 0x11, 0xa8, 0xcc, 0xcb, 0xab, 0x89, 0x30,
+        0x44, 0x34, 0x23, 0x01, 0xb9, 0xbe, 0xbc, 0x9b, 0x09, 0x41, 0x44, 0x33, 0x23, 0x90, 0xda, 0xcc,
+        0xba, 0x9a, 0x28, 0x53, 0x53, 0x23, 0x11, 0xa8, 0xcc, 0xcb, 0xab, 0x89, 0x31, 0x54, 0x33, 0x14,
+        0x81, 0xba, 0xcd, 0xba, 0x9b, 0x18, 0x53, 0x34, 0x33, 0x03, 0xa8, 0xdc, 0xbc, 0xba, 0x09, 0x21,
+        0x45, 0x43, 0x12, 0x91, 0xc9, 0xdb, 0xab, 0x9b, 0x10, 0x34, 0x45, 0x22, 0x01, 0xb8, 0xeb, 0xbb,
+        0x9b, 0x09, 0x42, 0x44, 0x24, 0x11, 0x90, 0xcb, 0xbc, 0xbb, 0x8a, 0x31, 0x45, 0x34, 0x22, 0x80,
+        0xca, 0xcc, 0xab, 0x9a, 0x10, 0x44, 0x34, 0x32, 0x81, 0xb9, 0xcd, 0xcb, 0x9a, 0x18, 0x42, 0x34,
+        0x24, 0x11, 0xa9, 0xcc, 0xcb, 0x9a, 0x09, 0x42, 0x34, 0x24, 0x02, 0x98, 0xbc, 0xbd, 0xab, 0x09,
+        0x42, 0x44, 0x23, 0x13, 0xa8, 0xeb, 0xcb, 0x9b, 0x0a, 0x31, 0x45, 0x33, 0x12, 0x90, 0xcc, 0xbc,
+        0xab, 0x89, 0x32, 0x36, 0x34, 0x12, 0x98, 0xdb, 0xbc, 0xab, 0x89, 0x32, 0x36, 0x34, 0x12, 0xa8,
+        0xdb, 0xbc, 0xab, 0x09, 0x42, 0x44, 0x33, 0x02, 0xa0, 0xbd, 0xcc, 0x9a, 0x09, 0x32, 0x45, 0x32,
+        0x11, 0xa9, 0xcc, 0xac, 0xaa, 0x18, 0x42, 0x25, 0x33, 0x01, 0xc9, 0xdb, 0xbb, 0x9b, 0x20, 0x63,
+        0x24, 0x23, 0x81, 0xca, 0xcc, 0xba, 0x99, 0x21, 0x44, 0x24, 0x13, 0x90, 0xdb, 0xcb, 0xab, 0x09,
+        0x41, 0x34, 0x34, 0x11, 0xa8, 0xdc, 0xab, 0x9b, 0x08, 0x63, 0x33, 0x24, 0x81, 0xba, 0xbd, 0xbc,
+        0x99, 0x21, 0x44, 0x24, 0x13, 0xa0, 0xda, 0xbc, 0xaa, 0x09, 0x42, 0x44, 0x23, 0x01, 0xa9, 0xbd,
+        0xbc, 0x9a, 0x10, 0x44, 0x34, 0x12, 0x91, 0xcb, 0xcc, 0x9b, 0x89, 0x32, 0x45, 0x23, 0x02, 0xb9,
+        0xcc, 0xac, 0x9a, 0x28, 0x34, 0x35, 0x22, 0x88, 0xdb, 0xdb, 0x9a, 0x09, 0x32, 0x44, 0x33, 0x01,
+        0xb9, 0xbe, 0xac, 0x8a, 0x20, 0x44, 0x43, 0x02, 0xa0, 0xcb, 0xbc, 0xab, 0x18, 0x63, 0x43, 0x22,
+        0x91, 0xca, 0xbc, 0xbb, 0x89, 0x52, 0x53, 0x23, 0x02, 0xb9, 0xcd, 0xab, 0x9a, 0x21, 0x35, 0x25,
+        0x02, 0xa0, 0xdb, 0xcb, 0x9a, 0x28, 0x43, 0x34, 0x23, 0x90, 0xeb, 0xcb, 0xaa, 0x08, 0x52, 0x43,
+        0x22, 0x81, 0xca, 0xbc, 0xac, 0x88, 0x32, 0x35, 0x24, 0x81, 0xb9, 0xdc, 0xaa, 0x8a, 0x31, 0x35,
+        0x24, 0x02, 0xa9, 0xbd, 0xbc, 0x89, 0x30, 0x44, 0x43, 0x11, 0xa9, 0xbc, 0xad, 0x8a, 0x20, 0x34,
+        0x25, 0x02, 0xa0, 0xcc, 0xbb, 0x9a, 0x20, 0x35, 0x25, 0x12, 0xa8, 0xdb, 0xac, 0x9a, 0x20, 0x53,
+        0x24, 0x12, 0xa8, 0xdb, 0xac, 0x9a, 0x20, 0x63, 0x23, 0x12, 0xa8, 0xcc, 0xac, 0x8a, 0x10, 0x44,
+        0x33, 0x12, 0xb8, 0xcd, 0xbb, 0x8a, 0x30, 0x45, 0x33, 0x02, 0xa9, 0xbe, 0xbb, 0x8b, 0x41, 0x44,
+        0x33, 0x01, 0xb9, 0xbe, 0xbb, 0x0a, 0x41, 0x35, 0x33, 0x01, 0xda, 0xbc, 0xbb, 0x88, 0x53, 0x34,
+        0x23, 0x91, 0xea, 0xbb, 0x9c, 0x08, 0x43, 0x34, 0x13, 0x90, 0xcc, 0xcb, 0x9a, 0x28, 0x63, 0x23,
+        0x03, 0xa8, 0xdc, 0xab, 0x8a, 0x30, 0x35, 0x34, 0x01, 0xc9, 0xdb, 0xab, 0x09, 0x42, 0x34, 0x23,
+        0x81, 0xdb, 0xbc, 0xab, 0x18, 0x63, 0x43, 0x12, 0x98, 0xbc, 0xbc, 0x9a, 0x30, 0x35, 0x34, 0x01,
+        0xb9, 0xcd, 0xba, 0x09, 0x42, 0x34, 0x33, 0x90, 0xdb, 0xbc, 0xab, 0x10, 0x54, 0x33, 0x02, 0xa8,
+        0xcd, 0xba, 0x8a, 0x32, 0x45, 0x32, 0x00, 0xca, 0xcc, 0x9a, 0x08, 0x43, 0x34, 0x12, 0xa8, 0xcc,
+        0xbb, 0x9a, 0x41, 0x44, 0x32, 0x81, 0xca, 0xbc, 0xab, 0x19, 0x44, 0x34, 0x12, 0xa8, 0xcc, 0xbb,
+        0x8b, 0x41, 0x44, 0x23, 0x81, 0xca, 0xcc, 0x9a, 0x18, 0x43, 0x24, 0x03, 0xa8, 0xbd, 0xac, 0x89,
+        0x41, 0x53, 0x22, 0x90, 0xca, 0xbc, 0x9a, 0x20, 0x44, 0x33, 0x02, 0xc9, 0xcc, 0xab, 0x08, 0x52,
+        0x43, 0x12, 0xa0, 0xdb, 0xac, 0x89, 0x30, 0x44, 0x23, 0x91, 0xda, 0xcb, 0x9a, 0x28, 0x44, 0x23,
+        0x02, 0xb9, 0xbe, 0xab, 0x19, 0x62, 0x33, 0x13, 0xa8, 0xcd, 0xbb, 0x89, 0x42, 0x34, 0x14, 0x80,
+        0xdb, 0xbb, 0x9a, 0x21, 0x36, 0x33, 0x81, 0xda, 0xbc, 0x9b, 0x28, 0x44, 0x24, 0x01, 0xa9, 0xbd,
+        0xab, 0x19, 0x63, 0x33, 0x03, 0xb8, 0xcd, 0xab, 0x09, 0x42, 0x25, 0x13, 0x98, 0xcc, 0xbb, 0x89,
+        0x41, 0x44, 0x22, 0x90, 0xdb, 0xbb, 0x9a, 0x41, 0x34, 0x24, 0x80, 0xcb, 0xbc, 0x9a, 0x30, 0x45,
+        0x22, 0x81, 0xca, 0xbc, 0x9b, 0x30, 0x54, 0x32, 0x81, 0xca, 0xbc, 0x9b, 0x20, 0x44, 0x24, 0x81,
+        0xc9, 0xcb, 0x9b, 0x10, 0x44, 0x33, 0x82, 0xca, 0xcc, 0x9a, 0x28, 0x53, 0x33, 0x01, 0xca, 0xcc,
+        0x9a, 0x28, 0x53, 0x33, 0x01, 0xca, 0xbd, 0x9a, 0x28, 0x44, 0x33, 0x01, 0xda, 0xac, 0x9b, 0x20,
+        0x63, 0x23, 0x01, 0xcb, 0xbc, 0xaa, 0x30, 0x35, 0x24, 0x81, 0xca, 0xad, 0x9a, 0x21, 0x44, 0x22,
+        0x91, 0xda, 0xcb, 0x89, 0x30, 0x44, 0x22, 0x90, 0xdb, 0xbb, 0x8a, 0x51, 0x43, 0x13, 0xa0, 0xcc,
+        0xbb, 0x09, 0x52, 0x43, 0x03, 0xa8, 0xdc, 0xaa, 0x08, 0x52, 0x33, 0x02, 0xc9, 0xbc, 0xab, 0x28,
+        0x44, 0x24, 0x82, 0xba, 0xae, 0x9a, 0x20, 0x34, 0x24, 0x91, 0xda, 0xcb, 0x89, 0x30, 0x35, 0x13,
+        0xa0, 0xcc, 0xbb, 0x89, 0x53, 0x34, 0x02, 0xb8, 0xbd, 0x9c, 0x18, 0x43, 0x24, 0x82, 0xba, 0xcd,
+        0x8a, 0x20, 0x53, 0x23, 0x90, 0xcb, 0xad, 0x89, 0x31, 0x35, 0x22, 0xb8, 0xcc, 0xbb, 0x08, 0x44,
+        0x33, 0x02, 0xd9, 0xbc, 0x9a, 0x20, 0x54, 0x22, 0x80, 0xcb, 0xbc, 0x89, 0x32, 0x26, 0x13, 0xa9,
+        0xcc, 0x9b, 0x19, 0x34, 0x25, 0x81, 0xc9, 0xcb, 0x8a, 0x30, 0x44, 0x22, 0x90, 0xcc, 0xab, 0x09,
+        0x52, 0x43, 0x02, 0xb9, 0xbd, 0x9b, 0x20, 0x54, 0x22, 0x91, 0xcb, 0xbc, 0x89, 0x42, 0x34, 0x12,
+        0xb9, 0xbd, 0x9c, 0x28, 0x53, 0x23, 0x81, 0xdb, 0xac, 0x89, 0x41, 0x43, 0x12, 0xa9, 0xbd, 0xab,
+        0x10, 0x35, 0x24, 0x91, 0xda, 0xbb, 0x0a, 0x51, 0x43, 0x12, 0xa9, 0xbd, 0xab, 0x20, 0x54, 0x22,
+        0x91, 0xcb, 0xbc, 0x09, 0x42, 0x34, 0x02, 0xb9, 0xbe, 0x9a, 0x20, 0x35, 0x23, 0x90, 0xbd, 0xac,
+        0x09, 0x43, 0x34, 0x01, 0xca, 0xbc, 0x8a, 0x40, 0x34, 0x13, 0xa8, 0xcd, 0xaa, 0x18, 0x34, 0x24,
+        0x81, 0xdb, 0xbb, 0x0a, 0x52, 0x24, 0x02, 0xb9, 0xbd, 0x9b, 0x31, 0x45, 0x12, 0xa0, 0xbc, 0xac,
+        0x18, 0x53, 0x33, 0x91, 0xdb, 0xcb, 0x89, 0x42, 0x24, 0x02, 0xb9, 0xbd, 0x8b, 0x30, 0x45, 0x12,
+        0xa0, 0xcc, 0x9b, 0x28, 0x53, 0x23, 0x91, 0xeb, 0xab, 0x09, 0x43, 0x34, 0x01, 0xda, 0xbb, 0x8b,
+        0x42, 0x35, 0x02, 0xc8, 0xcb, 0x9b, 0x21, 0x35, 0x23, 0xa8, 0xcd, 0xaa, 0x28, 0x53, 0x33, 0x90,
+        0xcc, 0xbb, 0x19, 0x63, 0x23, 0x01, 0xdb, 0xbb, 0x0a, 0x52, 0x24, 0x02, 0xba, 0xbd, 0x8b, 0x41,
+        0x34, 0x13, 0xc9, 0xbc, 0x9b, 0x40, 0x53, 0x22, 0xa8, 0xbd, 0x9b, 0x38, 0x44, 0x23, 0xa0, 0xcc,
+        0xab, 0x29, 0x44, 0x23, 0x91, 0xcc, 0xbb, 0x19, 0x44, 0x33, 0x91, 0xdb, 0xac, 0x09, 0x52, 0x23,
+        0x82, 0xcb, 0xbc, 0x0a, 0x52, 0x43, 0x01, 0xca, 0xcb, 0x89, 0x32, 0x35, 0x01, 0xc9, 0xbc, 0x99,
+        0x42, 0x43, 0x12, 0xba, 0xae, 0x8a, 0x40, 0x43, 0x02, 0xb9, 0xbd, 0x8a, 0x31, 0x35, 0x13, 0xc9,
+        0xcc, 0x99, 0x21, 0x44, 0x02, 0xa9, 0xcc, 0x8a, 0x21, 0x44, 0x02, 0xa9, 0xcc, 0x8a, 0x21, 0x44,
+        0x02, 0xa9, 0xcc, 0x8a, 0x21, 0x25, 0x12, 0xb9, 0xcc, 0x9a, 0x31, 0x35, 0x12, 0xc9, 0xbc, 0x8a,
+        0x41, 0x34, 0x02, 0xba, 0xae, 0x8a, 0x31, 0x35, 0x02, 0xca, 0xac, 0x8a, 0x42, 0x34, 0x01, 0xca,
+        0xbc, 0x89, 0x52, 0x33, 0x81, 0xda, 0xac, 0x09, 0x52, 0x23, 0x91, 0xda, 0xbb, 0x08, 0x34, 0x25,
+        0x90, 0xda, 0x9b, 0x29, 0x53, 0x13, 0x90, 0xcc, 0x9b, 0x28, 0x44, 0x13, 0xa8, 0xcc, 0xaa, 0x30,
+        0x44, 0x12, 0xb8, 0xbd, 0x8a, 0x40, 0x34, 0x11, 0xba, 0xbd, 0x8a, 0x42, 0x34, 0x82, 0xda, 0xbb,
+        0x1a, 0x62, 0x23, 0x91, 0xcb, 0xac, 0x19, 0x34, 0x24, 0xa0, 0xdb, 0xab, 0x20, 0x35, 0x13, 0xb8,
+        0xcd, 0x8a, 0x30, 0x44, 0x11, 0xba, 0xbc, 0x8a, 0x52, 0x24, 0x81, 0xca, 0xbb, 0x09, 0x44, 0x33,
+        0x90, 0xcc, 0xab, 0x28, 0x54, 0x12, 0xa8, 0xbc, 0x9b, 0x31, 0x36, 0x02, 0xc9, 0xac, 0x8a, 0x52,
+        0x23, 0x81, 0xcb, 0xac, 0x19, 0x53, 0x23, 0xa0, 0xcc, 0x9b, 0x20, 0x35, 0x13, 0xc9, 0xbc, 0x8a,
+        0x42, 0x34, 0x81, 0xda, 0xab, 0x09, 0x44, 0x23, 0xa0, 0xcc, 0xaa, 0x20, 0x35, 0x12, 0xb9, 0xbd,
+        0x8a, 0x51, 0x33, 0x82, 0xdb, 0xac, 0x19, 0x53, 0x13, 0xa0, 0xeb, 0x9a, 0x30, 0x53, 0x02, 0xb9,
+        0xad, 0x0a, 0x42, 0x33, 0x92, 0xcc, 0x9c, 0x18, 0x53, 0x12, 0xa8, 0xbc, 0x9b, 0x42, 0x34, 0x02,
+        0xdb, 0xbb, 0x19, 0x63, 0x23, 0xa0, 0xcc, 0xaa, 0x21, 0x35, 0x02, 0xc9, 0xac, 0x0a, 0x52, 0x23,
+        0x80, 0xcc, 0xaa, 0x20, 0x34, 0x13, 0xd8, 0xcb, 0x0a, 0x42, 0x33, 0x81, 0xcc, 0x9c, 0x18, 0x34,
+        0x13, 0xb9, 0xbd, 0x8a, 0x51, 0x43, 0x80, 0xca, 0xbb, 0x28, 0x35, 0x23, 0xb9, 0xbe, 0x8a, 0x42,
+        0x24, 0x81, 0xcb, 0x9c, 0x18, 0x34, 0x13, 0xb9, 0xbd, 0x8b, 0x52, 0x24, 0x91, 0xda, 0xaa, 0x28,
+        0x34, 0x13, 0xb9, 0xbe, 0x0a, 0x42, 0x24, 0x91, 0xdb, 0x9b, 0x20, 0x44, 0x02, 0xb9, 0xad, 0x0a,
+        0x43, 0x24, 0x98, 0xdb, 0x9a, 0x30, 0x44, 0x01, 0xba, 0xad, 0x08, 0x53, 0x22, 0xa8, 0xcc, 0x99,
+        0x41, 0x23, 0x92, 0xcb, 0xac, 0x28, 0x44, 0x02, 0xb8, 0xad, 0x0a, 0x42, 0x24, 0x90, 0xbc, 0x9b,
+        0x40, 0x34, 0x01, 0xca, 0xac, 0x19, 0x34, 0x23, 0xc8, 0xbc, 0x8a, 0x52, 0x33, 0x91, 0xcc, 0xab,
+        0x30, 0x35, 0x02, 0xca, 0xac, 0x19, 0x53, 0x13, 0xa8, 0xbd, 0x8a, 0x42, 0x24, 0x91, 0xdb, 0x9b,
+        0x20, 0x35, 0x82, 0xc9, 0xac, 0x08, 0x53, 0x22, 0xa9, 0xcc, 0x89, 0x32, 0x25, 0x90, 0xcb, 0x9b,
+        0x30, 0x35, 0x02, 0xdb, 0xab, 0x29, 0x35, 0x13, 0xc9, 0xbc, 0x09, 0x43, 0x24, 0xa8, 0xdb, 0x9a,
+        0x32, 0x25, 0x81, 0xdb, 0x9b, 0x20, 0x35, 0x01, 0xca, 0xbb, 0x29, 0x35, 0x23, 0xc9, 0xbc, 0x0a,
+        0x53, 0x23, 0xa0, 0xbd, 0x8b, 0x42, 0x24, 0x91, 0xdb, 0x9b, 0x30, 0x35, 0x01, 0xda, 0xab, 0x28,
+        0x44, 0x02, 0xb9, 0xad, 0x19, 0x43, 0x23, 0xb9, 0xbd, 0x0a, 0x52, 0x23, 0xb1, 0xcc, 0x9a, 0x32,
+        0x35, 0x80, 0xbc, 0x9c, 0x21, 0x34, 0x82, 0xcb, 0xac, 0x38, 0x34, 0x03, 0xda, 0xbb, 0x29, 0x44,
+        0x13, 0xc9, 0xac, 0x09, 0x43, 0x23, 0xb8, 0xbd, 0x0a, 0x52, 0x23, 0xa0, 0xbd, 0x8a, 0x51, 0x23,
+        0xa1, 0xeb, 0x8a, 0x30, 0x34, 0x91, 0xdb, 0xaa, 0x21, 0x35, 0x81, 0xda, 0x9b, 0x20, 0x34, 0x02,
+        0xcb, 0xac, 0x28, 0x34, 0x03, 0xca, 0xbc, 0x18, 0x44, 0x02, 0xb9, 0xac, 0x19, 0x53, 0x12, 0xb8,
+        0xad, 0x09, 0x43, 0x13, 0xb8, 0xbd, 0x09, 0x52, 0x13, 0xa8, 0xcc, 0x09, 0x32, 0x24, 0xa8, 0xbc,
+        0x8a, 0x52, 0x23, 0x98, 0xad, 0x8a, 0x32, 0x15, 0x90, 0xcb, 0x8a, 0x32, 0x24, 0x90, 0xbc, 0x8b,
+        0x42, 0x33, 0xa0, 0xbc, 0x8b, 0x42, 0x23, 0x90, 0xbc, 0x8a, 0x32, 0x23, 0xa0, 0xab, 0x09, 0x11,
+    };
+
+
+    // tick: 320 samples, 0.02 s, raw PCM (too short to be worth compressing)
+    const uint8_t tick[] = {
+        0x00, 0x00, 0xe5, 0x1e, 0x9d, 0x2a, 0x63, 0x1d, 0x00, 0x00, 0x0b, 0xe4, 0x71, 0xd9, 0x68, 0xe5,
+        0x00, 0x00, 0x4c, 0x19, 0xe4, 0x22, 0x10, 0x18, 0x00, 0x00, 0x1d, 0xe9, 0x6e, 0xe0, 0x3a, 0xea,
+        0x00, 0x00, 0xb6, 0x14, 0x91, 0x1c, 0xb3, 0x13, 0x00, 0x00, 0x43, 0xed, 0x27, 0xe6, 0x2d, 0xee,
+        0x00, 0x00, 0xf5, 0x10, 0x63, 0x17, 0x21, 0x10, 0x00, 0x00, 0xa8, 0xf0, 0xd7, 0xea, 0x68, 0xf1,
+        0x00, 0x00, 0xe2, 0x0d, 0x26, 0x13, 0x35, 0x0d, 0x00, 0x00, 0x70, 0xf3, 0xad, 0xee, 0x0d, 0xf4,
+        0x00, 0x00, 0x5e, 0x0b, 0xad, 0x0f, 0xd0, 0x0a, 0x00, 0x00, 0xb7, 0xf5, 0xd1, 0xf1, 0x38, 0xf6,
+        0x00, 0x00, 0x4e, 0x09, 0xd6, 0x0c, 0xda, 0x08, 0x00, 0x00, 0x94, 0xf7, 0x63, 0xf4, 0xfe, 0xf7,
+        0x00, 0x00, 0x9e, 0x07, 0x82, 0x0a, 0x3f, 0x07, 0x00, 0x00, 0x1b, 0xf9, 0x7e, 0xf6, 0x71, 0xf9,
+        0x00, 0x00, 0x3d, 0x06, 0x9b, 0x08, 0xef, 0x05, 0x00, 0x00, 0x5b, 0xfa, 0x37, 0xf8, 0xa2, 0xfa,
+        0x00, 0x00, 0x1b, 0x05, 0x0b, 0x07, 0xdc, 0x04, 0x00, 0x00, 0x61, 0xfb, 0xa0, 0xf9, 0x9b, 0xfb,
+        0x00, 0x00, 0x2e, 0x04, 0xc4, 0x05, 0xfa, 0x03, 0x00, 0x00, 0x37, 0xfc, 0xc8, 0xfa, 0x67, 0xfc,
+        0x00, 0x00, 0x6c, 0x03, 0xb9, 0x04, 0x42, 0x03, 0x00, 0x00, 0xe7, 0xfc, 0xba, 0xfb, 0x0e, 0xfd,
+        0x00, 0x00, 0xce, 0x02, 0xde, 0x03, 0xab, 0x02, 0x00, 0x00, 0x77, 0xfd, 0x81, 0xfc, 0x96, 0xfd,
+        0x00, 0x00, 0x4b, 0x02, 0x2a, 0x03, 0x2f, 0x02, 0x00, 0x00, 0xec, 0xfd, 0x23, 0xfd, 0x06, 0xfe,
+        0x00, 0x00, 0xe1, 0x01, 0x97, 0x02, 0xca, 0x01, 0x00, 0x00, 0x4d, 0xfe, 0xa8, 0xfd, 0x62, 0xfe,
+        0x00, 0x00, 0x8a, 0x01, 0x1f, 0x02, 0x77, 0x01, 0x00, 0x00, 0x9c, 0xfe, 0x15, 0xfe, 0xad, 0xfe,
+        0x00, 0x00, 0x42, 0x01, 0xbd, 0x01, 0x33, 0x01, 0x00, 0x00, 0xdc, 0xfe, 0x6e, 0xfe, 0xeb, 0xfe,
+        0x00, 0x00, 0x08, 0x01, 0x6c, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x11, 0xff, 0xb7, 0xfe, 0x1d, 0xff,
+        0x00, 0x00, 0xd8, 0x00, 0x2a, 0x01, 0xce, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xf2, 0xfe, 0x46, 0xff,
+        0x00, 0x00, 0xb1, 0x00, 0xf4, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x60, 0xff, 0x23, 0xff, 0x68, 0xff,
+        0x00, 0x00, 0x91, 0x00, 0xc8, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x4b, 0xff, 0x83, 0xff,
+        0x00, 0x00, 0x77, 0x00, 0xa4, 0x00, 0x71, 0x00, 0x00, 0x00, 0x95, 0xff, 0x6c, 0xff, 0x9a, 0xff,
+        0x00, 0x00, 0x61, 0x00, 0x86, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xa8, 0xff, 0x87, 0xff, 0xac, 0xff,
+        0x00, 0x00, 0x50, 0x00, 0x6e, 0x00, 0x4c, 0x00, 0x00, 0x00, 0xb8, 0xff, 0x9d, 0xff, 0xbc, 0xff,
+        0x00, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xaf, 0xff, 0xc8, 0xff,
+        0x00, 0x00, 0x35, 0x00, 0x4a, 0x00, 0x33, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xbd, 0xff, 0xd2, 0xff,
+        0x00, 0x00, 0x2c, 0x00, 0x3c, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xd9, 0xff, 0xca, 0xff, 0xda, 0xff,
+        0x00, 0x00, 0x24, 0x00, 0x31, 0x00, 0x22, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xd3, 0xff, 0xe1, 0xff,
+        0x00, 0x00, 0x1d, 0x00, 0x28, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xdb, 0xff, 0xe7, 0xff,
+        0x00, 0x00, 0x18, 0x00, 0x21, 0x00, 0x17, 0x00, 0x00, 0x00, 0xea, 0xff, 0xe2, 0xff, 0xeb, 0xff,
+        0x00, 0x00, 0x14, 0x00, 0x1b, 0x00, 0x13, 0x00, 0x00, 0x00, 0xee, 0xff, 0xe8, 0xff, 0xef, 0xff,
+        0x00, 0x00, 0x10, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xec, 0xff, 0xf2, 0xff,
+        0x00, 0x00, 0x0d, 0x00, 0x12, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xf0, 0xff, 0xf5, 0xff,
+        0x00, 0x00, 0x0b, 0x00, 0x0f, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xf3, 0xff, 0xf7, 0xff,
+        0x00, 0x00, 0x09, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xf5, 0xff, 0xf8, 0xff,
+        0x00, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xf7, 0xff, 0xfa, 0xff,
+        0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfb, 0xff, 0xf9, 0xff, 0xfb, 0xff,
+        0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfa, 0xff, 0xfc, 0xff,
+        0x00, 0x00, 0x04, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xfb, 0xff, 0xfd, 0xff,
+        0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfd, 0xff, 0xfc, 0xff, 0xfd, 0xff,
+    };
+}
+
+const AudioClip AUDIO_CLIPS[] = {
+    {"beep", "SOUND BEEP", AUDIO_IMA_ADPCM, beep, 2 * sizeof(beep)},
+    {"whirr", "SOUND WHIRR", AUDIO_IMA_ADPCM, whirr, 2 * sizeof(whirr)},
+    {"boot", "SOUND BOOT", AUDIO_IMA_ADPCM, boot, 2 * sizeof(boot)},
+    {"tick", "SOUND TICK", AUDIO_PCM16, tick, sizeof(tick) / 2},
+};
+
+const int AUDIO_CLIP_COUNT = sizeof(AUDIO_CLIPS) / sizeof(AUDIO_CLIPS[0]);
+
+int findAudioClip(const char *name)
+{
+    for (int id = 0; id < AUDIO_CLIP_COUNT; id++)
+    {
+        if (strcmp(AUDIO_CLIPS[id].name, name) == 0)
+            return id;
+    }
+    return -1;
+}
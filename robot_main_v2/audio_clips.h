@@ -0,0 +1,13 @@
+#ifndef AUDIO_CLIPS_H
+#define AUDIO_CLIPS_H
+
+#include "audio_mixer.h"
+
+// Built-in sound effects, stored in flash. Clip ids are indexes into
+// AUDIO_CLIPS; /cmd addresses them by name (target=sound&action=<name>).
+extern const AudioClip AUDIO_CLIPS[];
+extern const int AUDIO_CLIP_COUNT;
+
+int findAudioClip(const char *name);
+
+#endif
@@ -0,0 +1,190 @@
+#include <driver/i2s_std.h>
+
+#include "audio_engine.h"
+#include "audio_clips.h"
+#include "audio_mixer.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr size_t BLOCK_BYTES = RobotConst::AUDIO_BLOCK_FRAMES * sizeof(int16_t);
+
+    i2s_chan_handle_t txChannel = nullptr;
+    QueueHandle_t triggerQueue = nullptr;
+    volatile bool audioReady = false;
+    volatile bool playing = false;
+    volatile int activeVoices = 0;
+
+    uint32_t droppedTriggers = 0;
+    volatile uint32_t underrunCount = 0;
+    volatile uint32_t blocksWritten = 0;
+
+    // TX "send queue overflow": the DMA finished a buffer while every other
+    // buffer was still waiting to be refilled, so stale audio went out.
+    bool IRAM_ATTR onSendQueueOverflow(i2s_chan_handle_t, i2s_event_data_t *, void *)
+    {
+        underrunCount = underrunCount + 1;
+        return false;
+    }
+
+    void startQueuedClips()
+    {
+        uint8_t clipId;
+        while (xQueueReceive(triggerQueue, &clipId, 0) == pdTRUE)
+        {
+            if (clipId < AUDIO_CLIP_COUNT)
+                startAudioVoice(&AUDIO_CLIPS[clipId]);
+        }
+    }
+
+    void writeBlock(const int16_t *block)
+    {
+        size_t written = 0;
+        i2s_channel_write(txChannel, block, BLOCK_BYTES, &written, portMAX_DELAY);
+        blocksWritten = blocksWritten + 1;
+    }
+
+    // Sleeps on the trigger queue while silent. Once a clip starts, the DMA
+    // buffers are preloaded so sound goes out from the first one, then
+    // refilled block by block until every voice ends; trailing silence
+    // flushes the last block before the channel is stopped.
+    void audioTask(void *)
+    {
+        int16_t block[RobotConst::AUDIO_BLOCK_FRAMES];
+
+        for (;;)
+        {
+            uint8_t clipId;
+            if (xQueueReceive(triggerQueue, &clipId, portMAX_DELAY) != pdTRUE || clipId >= AUDIO_CLIP_COUNT)
+                continue;
+
+            startAudioVoice(&AUDIO_CLIPS[clipId]);
+            playing = true;
+
+            int active = 1;
+            for (int i = 0; i < RobotConst::AUDIO_DMA_BUFFERS; i++)
+            {
+                size_t loaded = 0;
+                active = mixAudioBlock(block, RobotConst::AUDIO_BLOCK_FRAMES);
+                i2s_channel_preload_data(txChannel, block, BLOCK_BYTES, &loaded);
+            }
+            i2s_channel_enable(txChannel);
+
+            while (active > 0 || uxQueueMessagesWaiting(triggerQueue) > 0)
+            {
+                startQueuedClips();
+                active = mixAudioBlock(block, RobotConst::AUDIO_BLOCK_FRAMES);
+                activeVoices = active;
+                writeBlock(block);
+            }
+
+            memset(block, 0, sizeof(block));
+            for (int i = 0; i < RobotConst::AUDIO_DMA_BUFFERS; i++)
+                writeBlock(block);
+
+            i2s_channel_disable(txChannel);
+            activeVoices = 0;
+            playing = false;
+        }
+    }
+
+    bool initI2s()
+    {
+        i2s_chan_config_t channelConfig = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+        channelConfig.dma_desc_num = RobotConst::AUDIO_DMA_BUFFERS;
+        channelConfig.dma_frame_num = RobotConst::AUDIO_BLOCK_FRAMES;
+        channelConfig.auto_clear = true;
+        if (i2s_new_channel(&channelConfig, &txChannel, nullptr) != ESP_OK)
+            return false;
+
+        i2s_std_config_t stdConfig = {
+            .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(RobotConst::AUDIO_SAMPLE_RATE),
+            .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+            .gpio_cfg = {
+                .mclk = I2S_GPIO_UNUSED,
+                .bclk = (gpio_num_t)RobotPins::I2S_BCLK_PIN,
+                .ws = (gpio_num_t)RobotPins::I2S_LRCLK_PIN,
+                .dout = (gpio_num_t)RobotPins::I2S_DOUT_PIN,
+                .din = I2S_GPIO_UNUSED,
+                .invert_flags = {false, false, false},
+            },
+        };
+
+        i2s_event_callbacks_t callbacks = {};
+        callbacks.on_send_q_ovf = onSendQueueOverflow;
+
+        return i2s_channel_init_std_mode(txChannel, &stdConfig) == ESP_OK &&
+               i2s_channel_register_event_callback(txChannel, &callbacks, nullptr) == ESP_OK;
+    }
+}
+
+bool initAudio()
+{
+    if (audioReady)
+        return true;
+
+    resetAudioMixer();
+
+    if (!initI2s())
+    {
+        Serial.println("[ERROR] I2S audio init failed");
+        return false;
+    }
+
+    triggerQueue = xQueueCreate(RobotConst::AUDIO_TRIGGER_QUEUE_DEPTH, sizeof(uint8_t));
+    if (triggerQueue == nullptr)
+        return false;
+
+    BaseType_t created = xTaskCreatePinnedToCore(
+        audioTask,
+        "audio",
+        RobotConst::AUDIO_TASK_STACK_SIZE,
+        nullptr,
+        RobotConst::AUDIO_TASK_PRIORITY,
+        nullptr,
+        RobotConst::AUDIO_TASK_CORE);
+    if (created != pdPASS)
+        return false;
+
+    audioReady = true;
+    Serial.print("[INFO] Audio ready: ");
+    Serial.print(AUDIO_CLIP_COUNT);
+    Serial.println(" clips");
+    return true;
+}
+
+bool isAudioReady()
+{
+    return audioReady;
+}
+
+bool playSound(uint8_t clipId)
+{
+    if (!audioReady || clipId >= AUDIO_CLIP_COUNT)
+        return false;
+
+    if (xQueueSend(triggerQueue, &clipId, 0) != pdTRUE)
+    {
+        droppedTriggers++;
+        return false;
+    }
+    return true;
+}
+
+bool isAudioPlaying()
+{
+    return playing;
+}
+
+void appendAudioStatus(ResponseWriter &out)
+{
+    const AudioMixerStats &stats = getAudioMixerStats();
+
+    appendResponseFormat(out,
+                         ",\"audio\":{\"ready\":%s,\"playing\":%s,\"voices\":%d,\"started\":%lu,\"stolen\":%lu,"
+                         "\"dropped\":%lu,\"underruns\":%lu,\"clipped\":%lu,\"blocks\":%lu}",
+                         audioReady ? "true" : "false", playing ? "true" : "false", activeVoices,
+                         (unsigned long)stats.started, (unsigned long)stats.stolen, (unsigned long)droppedTriggers,
+                         (unsigned long)underrunCount, (unsigned long)stats.clippedSamples,
+                         (unsigned long)blocksWritten);
+}
@@ -0,0 +1,21 @@
+#ifndef AUDIO_ENGINE_H
+#define AUDIO_ENGINE_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+// I2S sound effects. A dedicated task mixes up to AUDIO_VOICES clips into
+// DMA buffers while a sound plays and sleeps otherwise; callers only queue
+// a trigger.
+bool initAudio();
+bool isAudioReady();
+
+// Queues a clip (an index into AUDIO_CLIPS) without waiting. Returns false
+// if the engine is not running or the trigger queue is full.
+bool playSound(uint8_t clipId);
+
+bool isAudioPlaying();
+void appendAudioStatus(ResponseWriter &out);
+
+#endif
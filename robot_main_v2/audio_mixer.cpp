@@ -0,0 +1,169 @@
+#include <string.h>
+
+#include "audio_mixer.h"
+#include "robot_constants.h"
+
+namespace
+{
+    const int16_t STEP_TABLE[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+        337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+    const int8_t INDEX_TABLE[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+    struct Voice
+    {
+        const AudioClip *clip;
+        uint32_t position;
+        AdpcmState adpcm;
+        uint32_t startOrder;
+    };
+
+    Voice voices[RobotConst::AUDIO_VOICES];
+    uint32_t nextStartOrder = 0;
+    AudioMixerStats stats = {};
+
+    int32_t clampSample(int32_t value)
+    {
+        return value < -32768 ? -32768 : (value > 32767 ? 32767 : value);
+    }
+
+    // Decodes the voice's next count samples and advances it.
+    void readVoice(Voice &voice, int count, int16_t *out)
+    {
+        const AudioClip &clip = *voice.clip;
+        if (clip.format == AUDIO_IMA_ADPCM)
+        {
+            decodeAdpcm(clip.data, voice.position, count, voice.adpcm, out);
+        }
+        else
+        {
+            const uint8_t *bytes = clip.data + 2 * voice.position;
+            for (int i = 0; i < count; i++)
+                out[i] = (int16_t)(bytes[2 * i] | (bytes[2 * i + 1] << 8));
+        }
+        voice.position += (uint32_t)count;
+    }
+}
+
+int16_t decodeAdpcmSample(AdpcmState &state, uint8_t nibble)
+{
+    int32_t step = STEP_TABLE[state.stepIndex];
+    int32_t diff = step >> 3;
+    if (nibble & 4)
+        diff += step;
+    if (nibble & 2)
+        diff += step >> 1;
+    if (nibble & 1)
+        diff += step >> 2;
+
+    state.predictor = clampSample((nibble & 8) ? state.predictor - diff : state.predictor + diff);
+
+    int32_t index = state.stepIndex + INDEX_TABLE[nibble & 7];
+    state.stepIndex = index < 0 ? 0 : (index > 88 ? 88 : index);
+    return (int16_t)state.predictor;
+}
+
+void decodeAdpcm(const uint8_t *data, uint32_t first, int count, AdpcmState &state, int16_t *out)
+{
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t sample = first + (uint32_t)i;
+        uint8_t byte = data[sample >> 1];
+        out[i] = decodeAdpcmSample(state, (sample & 1) ? (byte >> 4) : (byte & 0x0F));
+    }
+}
+
+void resetAudioMixer()
+{
+    memset(voices, 0, sizeof(voices));
+    nextStartOrder = 0;
+    stats = AudioMixerStats();
+}
+
+void startAudioVoice(const AudioClip *clip)
+{
+    if (clip == nullptr || clip->sampleCount == 0)
+        return;
+
+    Voice *target = nullptr;
+    for (Voice &voice : voices)
+    {
+        if (voice.clip == nullptr)
+        {
+            target = &voice;
+            break;
+        }
+        if (target == nullptr || (int32_t)(voice.startOrder - target->startOrder) < 0)
+            target = &voice;
+    }
+
+    if (target->clip != nullptr)
+        stats.stolen++;
+
+    target->clip = clip;
+    target->position = 0;
+    target->adpcm = AdpcmState();
+    target->startOrder = nextStartOrder++;
+    stats.started++;
+}
+
+int mixAudioBlock(int16_t *out, int frames)
+{
+    if (frames > RobotConst::AUDIO_BLOCK_FRAMES)
+        frames = RobotConst::AUDIO_BLOCK_FRAMES;
+
+    int32_t sum[RobotConst::AUDIO_BLOCK_FRAMES] = {};
+    int16_t decoded[RobotConst::AUDIO_BLOCK_FRAMES];
+    int active = 0;
+
+    for (Voice &voice : voices)
+    {
+        if (voice.clip == nullptr)
+            continue;
+
+        uint32_t remaining = voice.clip->sampleCount - voice.position;
+        int count = remaining < (uint32_t)frames ? (int)remaining : frames;
+        readVoice(voice, count, decoded);
+        for (int i = 0; i < count; i++)
+            sum[i] += decoded[i];
+
+        if (voice.position >= voice.clip->sampleCount)
+        {
+            voice.clip = nullptr;
+            stats.completed++;
+        }
+        else
+        {
+            active++;
+        }
+    }
+
+    for (int i = 0; i < frames; i++)
+    {
+        int32_t sample = clampSample(sum[i]);
+        if (sample != sum[i])
+            stats.clippedSamples++;
+        out[i] = (int16_t)sample;
+    }
+    return active;
+}
+
+int countActiveAudioVoices()
+{
+    int active = 0;
+    for (const Voice &voice : voices)
+    {
+        if (voice.clip != nullptr)
+            active++;
+    }
+    return active;
+}
+
+const AudioMixerStats &getAudioMixerStats()
+{
+    return stats;
+}
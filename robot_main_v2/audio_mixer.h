@@ -0,0 +1,59 @@
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <stdint.h>
+
+// Clip decoding and voice mixing for the audio engine. Plain C++ with no
+// Arduino dependencies, so host/audio_tool can check the decoder and render
+// clips off the robot.
+
+enum AudioFormat : uint8_t
+{
+    AUDIO_PCM16,    // little-endian signed 16-bit samples
+    AUDIO_IMA_ADPCM // 4-bit IMA ADPCM, low nibble first, starting from silence
+};
+
+struct AudioClip
+{
+    const char *name;
+    const char *reply;
+    AudioFormat format;
+    const uint8_t *data;
+    uint32_t sampleCount;
+};
+
+struct AdpcmState
+{
+    int32_t predictor;
+    int32_t stepIndex;
+};
+
+struct AudioMixerStats
+{
+    uint32_t started;
+    uint32_t stolen;
+    uint32_t completed;
+    uint32_t clippedSamples;
+};
+
+// Decodes one nibble and advances the state.
+int16_t decodeAdpcmSample(AdpcmState &state, uint8_t nibble);
+
+// Decodes count samples from sample index first on. The state must be the
+// one left after sample first - 1, so a clip is decoded front to back.
+void decodeAdpcm(const uint8_t *data, uint32_t first, int count, AdpcmState &state, int16_t *out);
+
+void resetAudioMixer();
+
+// Starts the clip on a free voice, or on the one that started earliest when
+// all AUDIO_VOICES are busy.
+void startAudioVoice(const AudioClip *clip);
+
+// Mixes up to AUDIO_BLOCK_FRAMES frames of every active voice into out,
+// saturating at full scale. Returns the number of voices still active.
+int mixAudioBlock(int16_t *out, int frames);
+
+int countActiveAudioVoices();
+const AudioMixerStats &getAudioMixerStats();
+
+#endif
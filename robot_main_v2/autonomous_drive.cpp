@@ -1,5 +1,6 @@
 #include "autonomous_drive.h"
 #include "motor_control.h"
+#include "range_sensor.h"
 #include "robot_constants.h"
 
 enum DriveState
@@ -8,7 +9,8 @@ enum DriveState
     TURN_RIGHT,
     DRIVE_FORWARD_2,
     TURN_LEFT,
-    DRIVE_STOP
+    DRIVE_STOP,
+    AVOID_TURN
 };
 
 namespace
@@ -16,6 +18,15 @@ namespace
     DriveState driveState = DRIVE_FORWARD_1;
     unsigned long stateStartMs = 0;
     bool autonomousDriveEnabled = false;
+    int appliedForwardSpeed = 0;
+    uint32_t avoidCount = 0;
+    bool rangeLost = false;
+    DriveTuning tuning = getDefaultDriveTuning();
+
+    bool isForwardState(DriveState state)
+    {
+        return state == DRIVE_FORWARD_1 || state == DRIVE_FORWARD_2;
+    }
 
     void setDriveState(DriveState nextState)
     {
@@ -25,26 +36,80 @@ namespace
         switch (driveState)
         {
         case DRIVE_FORWARD_1:
-            driveTank(RobotConst::FORWARD_SPEED, RobotConst::FORWARD_SPEED);
+            driveTank(tuning.forwardSpeed, tuning.forwardSpeed);
+            appliedForwardSpeed = tuning.forwardSpeed;
             Serial.println("Drive: FORWARD 1");
             break;
         case TURN_RIGHT:
-            driveTank(RobotConst::TURN_SPEED, -RobotConst::TURN_SPEED);
+            driveTank(tuning.turnSpeed, -tuning.turnSpeed);
             Serial.println("Drive: TURN RIGHT");
             break;
         case DRIVE_FORWARD_2:
-            driveTank(RobotConst::FORWARD_SPEED, RobotConst::FORWARD_SPEED);
+            driveTank(tuning.forwardSpeed, tuning.forwardSpeed);
+            appliedForwardSpeed = tuning.forwardSpeed;
             Serial.println("Drive: FORWARD 2");
             break;
         case TURN_LEFT:
-            driveTank(-RobotConst::TURN_SPEED, RobotConst::TURN_SPEED);
+            driveTank(-tuning.turnSpeed, tuning.turnSpeed);
             Serial.println("Drive: TURN LEFT");
             break;
         case DRIVE_STOP:
             stopMotors();
             Serial.println("Drive: STOP");
             break;
+        case AVOID_TURN:
+            driveTank(tuning.turnSpeed, -tuning.turnSpeed);
+            avoidCount++;
+            Serial.println("Drive: AVOID TURN");
+            break;
+        }
+    }
+
+    int forwardSpeedForDistance(uint16_t distanceMm)
+    {
+        int crawlSpeed = min<int>(RobotConst::CRAWL_SPEED, tuning.forwardSpeed);
+        if (distanceMm >= RobotConst::RANGE_SLOW_MM)
+            return tuning.forwardSpeed;
+
+        long scaled = map(distanceMm, RobotConst::RANGE_STOP_MM, RobotConst::RANGE_SLOW_MM,
+                          crawlSpeed, tuning.forwardSpeed);
+        return constrain((int)scaled, crawlSpeed, (int)tuning.forwardSpeed);
+    }
+
+    // Evaluated every loop tick, independent of the sequence timers, so the
+    // reaction bound is the range filter delay plus one tick.
+    bool reactToObstacle()
+    {
+        if (!isForwardState(driveState))
+            return false;
+
+        // A silent sensor is treated as unknown ground: crawl, don't stop.
+        int speed = min<int>(RobotConst::CRAWL_SPEED, tuning.forwardSpeed);
+        bool fresh = isRangeReadingFresh();
+        if (fresh == rangeLost)
+        {
+            rangeLost = !fresh;
+            Serial.println(rangeLost ? "Drive: RANGE LOST, CRAWLING" : "Drive: RANGE BACK");
+        }
+
+        if (fresh)
+        {
+            uint16_t distanceMm = getRangeDistanceMm();
+            if (distanceMm <= RobotConst::RANGE_STOP_MM)
+            {
+                setDriveState(AVOID_TURN);
+                return true;
+            }
+            speed = forwardSpeedForDistance(distanceMm);
+        }
+
+        if (speed != appliedForwardSpeed)
+        {
+            driveTank(speed, speed);
+            appliedForwardSpeed = speed;
         }
+
+        return false;
     }
 }
 
@@ -60,29 +125,38 @@ void updateAutonomousDrive()
     if (!autonomousDriveEnabled)
         return;
 
+    if (reactToObstacle())
+        return;
+
     unsigned long now = millis();
     unsigned long elapsed = now - stateStartMs;
 
     switch (driveState)
     {
     case DRIVE_FORWARD_1:
-        if (elapsed >= RobotConst::DURATION_FORWARD_1)
+        if (elapsed >= tuning.forward1Ms)
             setDriveState(TURN_RIGHT);
         break;
     case TURN_RIGHT:
-        if (elapsed >= RobotConst::DURATION_TURN_RIGHT)
+        if (elapsed >= tuning.turnRightMs)
             setDriveState(DRIVE_FORWARD_2);
         break;
     case DRIVE_FORWARD_2:
-        if (elapsed >= RobotConst::DURATION_FORWARD_2)
+        if (elapsed >= tuning.forward2Ms)
             setDriveState(TURN_LEFT);
         break;
     case TURN_LEFT:
-        if (elapsed >= RobotConst::DURATION_TURN_LEFT)
+        if (elapsed >= tuning.turnLeftMs)
             setDriveState(DRIVE_STOP);
         break;
     case DRIVE_STOP:
-        if (elapsed >= RobotConst::DURATION_STOP)
+        if (elapsed >= tuning.stopMs)
+            setDriveState(DRIVE_FORWARD_1);
+        break;
+    case AVOID_TURN:
+        if (elapsed >= RobotConst::AVOID_MAX_TURN_MS ||
+            (elapsed >= RobotConst::AVOID_MIN_TURN_MS && isRangeReadingFresh() &&
+             getRangeDistanceMm() >= RobotConst::RANGE_CLEAR_MM))
             setDriveState(DRIVE_FORWARD_1);
         break;
     }
@@ -102,3 +176,36 @@ bool isAutonomousDriveEnabled()
 {
     return autonomousDriveEnabled;
 }
+
+bool isAutonomousDriveDegraded()
+{
+    return autonomousDriveEnabled && !isRangeReadingFresh();
+}
+
+uint32_t getObstacleAvoidCount()
+{
+    return avoidCount;
+}
+
+DriveTuning getDefaultDriveTuning()
+{
+    DriveTuning defaults;
+    defaults.forwardSpeed = RobotConst::FORWARD_SPEED;
+    defaults.turnSpeed = RobotConst::TURN_SPEED;
+    defaults.forward1Ms = RobotConst::DURATION_FORWARD_1;
+    defaults.turnRightMs = RobotConst::DURATION_TURN_RIGHT;
+    defaults.forward2Ms = RobotConst::DURATION_FORWARD_2;
+    defaults.turnLeftMs = RobotConst::DURATION_TURN_LEFT;
+    defaults.stopMs = RobotConst::DURATION_STOP;
+    return defaults;
+}
+
+void setAutonomousDriveTuning(const DriveTuning &nextTuning)
+{
+    tuning = nextTuning;
+}
+
+DriveTuning getAutonomousDriveTuning()
+{
+    return tuning;
+}
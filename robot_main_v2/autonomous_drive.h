@@ -1,9 +1,29 @@
 #ifndef AUTONOMOUS_DRIVE_H
 #define AUTONOMOUS_DRIVE_H
 
+#include <stdint.h>
+
+struct DriveTuning
+{
+    uint8_t forwardSpeed;
+    uint8_t turnSpeed;
+    unsigned long forward1Ms;
+    unsigned long turnRightMs;
+    unsigned long forward2Ms;
+    unsigned long turnLeftMs;
+    unsigned long stopMs;
+};
+
 void initAutonomousDrive();
 void updateAutonomousDrive();
 void setAutonomousDriveEnabled(bool enabled);
 bool isAutonomousDriveEnabled();
+// True while autonomous drive runs without a fresh range reading and so
+// crawls blind instead of reacting to obstacles.
+bool isAutonomousDriveDegraded();
+uint32_t getObstacleAvoidCount();
+DriveTuning getDefaultDriveTuning();
+void setAutonomousDriveTuning(const DriveTuning &tuning);
+DriveTuning getAutonomousDriveTuning();
 
 #endif
@@ -0,0 +1,210 @@
+#include <esp_timer.h>
+
+#include "boot_stages.h"
+#include "power_manager.h"
+#include "robot_constants.h"
+
+namespace
+{
+    enum StageState : uint8_t
+    {
+        STAGE_PENDING,
+        STAGE_RUNNING,
+        STAGE_DONE,
+        STAGE_FAILED
+    };
+
+    struct StageInfo
+    {
+        const char *name;
+        uint8_t dependsOn; // bitmask of BootStage
+    };
+
+    constexpr uint8_t bit(BootStage stage)
+    {
+        return 1 << stage;
+    }
+
+    constexpr StageInfo STAGES[BOOT_STAGE_COUNT] = {
+        {"safe", 0},
+        {"servos", bit(BOOT_SAFE)},
+        {"display", bit(BOOT_SAFE)},
+        {"network", bit(BOOT_SAFE)},
+        {"http", bit(BOOT_NETWORK)},
+        {"audio", bit(BOOT_SAFE)},
+    };
+
+    // Written by whichever task runs the stage, read by /boot.
+    struct StageRecord
+    {
+        volatile StageState state;
+        volatile uint32_t startUs;
+        volatile uint32_t endUs;
+        volatile int8_t core;
+    };
+
+    StageRecord records[BOOT_STAGE_COUNT];
+    BootWork taskWork[BOOT_STAGE_COUNT];
+
+    uint32_t bootClockUs()
+    {
+        return (uint32_t)esp_timer_get_time();
+    }
+
+    const char *stateName(StageState state)
+    {
+        switch (state)
+        {
+        case STAGE_PENDING:
+            return "pending";
+        case STAGE_RUNNING:
+            return "running";
+        case STAGE_DONE:
+            return "done";
+        case STAGE_FAILED:
+        default:
+            return "failed";
+        }
+    }
+
+    bool dependenciesDone(BootStage stage)
+    {
+        for (int other = 0; other < BOOT_STAGE_COUNT; other++)
+        {
+            if ((STAGES[stage].dependsOn & bit((BootStage)other)) && records[other].state != STAGE_DONE)
+                return false;
+        }
+        return true;
+    }
+
+    bool claimStage(BootStage stage)
+    {
+        if (records[stage].state != STAGE_PENDING)
+            return false;
+
+        if (!dependenciesDone(stage))
+        {
+            Serial.print("[ERROR] Boot stage started before its dependencies: ");
+            Serial.println(STAGES[stage].name);
+            records[stage].state = STAGE_FAILED;
+            return false;
+        }
+
+        records[stage].state = STAGE_RUNNING;
+        return true;
+    }
+
+    bool executeStage(BootStage stage, BootWork work)
+    {
+        StageRecord &record = records[stage];
+        record.core = (int8_t)xPortGetCoreID();
+        record.startUs = bootClockUs();
+        bool ok = work();
+        record.endUs = bootClockUs();
+        record.state = ok ? STAGE_DONE : STAGE_FAILED;
+
+        Serial.print(ok ? "[INFO] Boot stage done: " : "[ERROR] Boot stage failed: ");
+        Serial.print(STAGES[stage].name);
+        Serial.print(" (");
+        Serial.print((unsigned long)((record.endUs - record.startUs) / 1000));
+        Serial.println(" ms)");
+
+        // The loop may be waiting out a long tick without this stage's deadlines.
+        wakePowerLoop();
+        return ok;
+    }
+
+    void bootStageTask(void *param)
+    {
+        BootStage stage = (BootStage)(uintptr_t)param;
+        executeStage(stage, taskWork[stage]);
+        vTaskDelete(nullptr);
+    }
+}
+
+bool runBootStage(BootStage stage, BootWork work)
+{
+    if (!claimStage(stage))
+        return false;
+
+    return executeStage(stage, work);
+}
+
+bool startBootStageTask(BootStage stage, BootWork work, int core)
+{
+    if (!claimStage(stage))
+        return false;
+
+    taskWork[stage] = work;
+    BaseType_t created = xTaskCreatePinnedToCore(
+        bootStageTask,
+        STAGES[stage].name,
+        RobotConst::BOOT_TASK_STACK_SIZE,
+        (void *)(uintptr_t)stage,
+        RobotConst::BOOT_TASK_PRIORITY,
+        nullptr,
+        core);
+
+    if (created != pdPASS)
+    {
+        // No task, so run it here rather than boot without it.
+        Serial.print("[ERROR] Boot task start failed, running inline: ");
+        Serial.println(STAGES[stage].name);
+        return executeStage(stage, work);
+    }
+    return true;
+}
+
+bool isBootStageDone(BootStage stage)
+{
+    return records[stage].state == STAGE_DONE;
+}
+
+bool isBootComplete()
+{
+    for (const StageRecord &record : records)
+    {
+        if (record.state == STAGE_PENDING || record.state == STAGE_RUNNING)
+            return false;
+    }
+    return true;
+}
+
+void appendBootStatus(ResponseWriter &out)
+{
+    uint32_t controllableUs = 0;
+    uint32_t completeUs = 0;
+
+    appendResponse(out, "{\"stages\":[");
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++)
+    {
+        const StageRecord &record = records[i];
+        StageState state = record.state;
+        bool finished = state == STAGE_DONE || state == STAGE_FAILED;
+
+        appendResponseFormat(out, "%s{\"name\":\"%s\",\"state\":\"%s\"", i > 0 ? "," : "", STAGES[i].name,
+                             stateName(state));
+        if (state != STAGE_PENDING)
+            appendResponseFormat(out, ",\"core\":%d,\"start_us\":%lu", record.core, (unsigned long)record.startUs);
+        if (finished)
+            appendResponseFormat(out, ",\"end_us\":%lu,\"took_us\":%lu", (unsigned long)record.endUs,
+                                 (unsigned long)(record.endUs - record.startUs));
+        appendResponse(out, "}");
+
+        if (finished && record.endUs > completeUs)
+            completeUs = record.endUs;
+        if (i == BOOT_HTTP && state == STAGE_DONE)
+            controllableUs = record.endUs;
+    }
+    appendResponse(out, "]");
+
+    // Both null until reached.
+    if (controllableUs != 0)
+        appendResponseFormat(out, ",\"controllable_us\":%lu", (unsigned long)controllableUs);
+    else
+        appendResponse(out, ",\"controllable_us\":null");
+    if (isBootComplete())
+        appendResponseFormat(out, ",\"complete_us\":%lu}", (unsigned long)completeUs);
+    else
+        appendResponse(out, ",\"complete_us\":null}");
+}
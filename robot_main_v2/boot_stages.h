@@ -0,0 +1,41 @@
+#ifndef BOOT_STAGES_H
+#define BOOT_STAGES_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+// Boot is split into stages that run as soon as the stages they depend on
+// are done:
+//
+//   safe     : motors stopped, sensors and bookkeeping ready
+//   servos   : PCA9685 bank and I2C queue (background task)   ← safe
+//   display  : TFT init and gauge frame (background task)      ← safe
+//   network  : AP channel scan and start, power, UDP sync      ← safe
+//   http     : routes registered, server listening             ← network
+//   audio    : I2S channel and audio task                      ← safe
+enum BootStage : uint8_t
+{
+    BOOT_SAFE,
+    BOOT_SERVOS,
+    BOOT_DISPLAY,
+    BOOT_NETWORK,
+    BOOT_HTTP,
+    BOOT_AUDIO,
+    BOOT_STAGE_COUNT
+};
+
+typedef bool (*BootWork)();
+
+// Runs the stage on the calling task.
+bool runBootStage(BootStage stage, BootWork work);
+
+// Runs the stage on its own FreeRTOS task pinned to core; the task exits when
+// the work returns.
+bool startBootStageTask(BootStage stage, BootWork work, int core);
+
+bool isBootStageDone(BootStage stage);
+bool isBootComplete();
+void appendBootStatus(ResponseWriter &out);
+
+#endif
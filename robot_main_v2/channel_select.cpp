@@ -0,0 +1,54 @@
+#include "channel_select.h"
+#include "robot_constants.h"
+
+namespace
+{
+    // 2.4 GHz channels are 5 MHz apart but about 20 MHz wide, so a network
+    // also loads the four channels on either side, less the further away.
+    constexpr int OVERLAP_SPAN = 5;
+
+    // Networks at the noise floor cost nothing; anything at or above the
+    // strong level counts fully. Linear in dB between the two.
+    constexpr int NOISE_FLOOR_DBM = -95;
+    constexpr int STRONG_DBM = -50;
+
+    uint32_t signalWeight(int rssiDbm)
+    {
+        if (rssiDbm <= NOISE_FLOOR_DBM)
+            return 0;
+        if (rssiDbm >= STRONG_DBM)
+            return STRONG_DBM - NOISE_FLOOR_DBM;
+        return (uint32_t)(rssiDbm - NOISE_FLOOR_DBM);
+    }
+}
+
+void scoreChannels(const ScanSample *samples, int count, uint32_t scores[])
+{
+    for (int channel = 0; channel <= RobotConst::AP_CHANNEL_MAX; channel++)
+        scores[channel] = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t weight = signalWeight(samples[i].rssiDbm);
+        for (int channel = 1; channel <= RobotConst::AP_CHANNEL_MAX; channel++)
+        {
+            int distance = channel > samples[i].channel ? channel - samples[i].channel : samples[i].channel - channel;
+            if (distance < OVERLAP_SPAN)
+                scores[channel] += weight * (uint32_t)(OVERLAP_SPAN - distance);
+        }
+    }
+}
+
+uint8_t selectQuietestChannel(const ScanSample *samples, int count)
+{
+    uint32_t scores[RobotConst::AP_CHANNEL_MAX + 1];
+    scoreChannels(samples, count, scores);
+
+    uint8_t best = RobotConst::AP_CHANNEL_CANDIDATES[0];
+    for (uint8_t channel : RobotConst::AP_CHANNEL_CANDIDATES)
+    {
+        if (scores[channel] < scores[best])
+            best = channel;
+    }
+    return best;
+}
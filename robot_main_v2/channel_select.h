@@ -0,0 +1,22 @@
+#ifndef CHANNEL_SELECT_H
+#define CHANNEL_SELECT_H
+
+#include <stdint.h>
+
+// Soft AP channel choice from a Wi-Fi scan. Plain C++ with no Arduino
+// dependencies, so host/channel_pick can replay recorded scans through it.
+
+struct ScanSample
+{
+    uint8_t channel;
+    int8_t rssiDbm;
+};
+
+// Congestion score for every 2.4 GHz channel, indexed by channel number
+// (scores[0] is unused). Higher means busier.
+void scoreChannels(const ScanSample *samples, int count, uint32_t scores[]);
+
+// Least congested of AP_CHANNEL_CANDIDATES; ties go to the earlier candidate.
+uint8_t selectQuietestChannel(const ScanSample *samples, int count);
+
+#endif
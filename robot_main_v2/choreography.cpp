@@ -0,0 +1,100 @@
+#include <AsyncUDP.h>
+#include <esp_timer.h>
+
+#include "choreography.h"
+#include "power_manager.h"
+#include "robot_constants.h"
+
+namespace
+{
+    AsyncUDP udp;
+    bool listening = false;
+    uint32_t blockedCount = 0;
+
+    // Packets are handled on the lwIP task, the queue is drained by loop().
+    portMUX_TYPE schedulerLock = portMUX_INITIALIZER_UNLOCKED;
+
+    uint64_t clockUs()
+    {
+        return (uint64_t)esp_timer_get_time();
+    }
+
+    // Pings are answered straight from the receive callback, so the clock
+    // sample does not include however long loop() happens to be asleep.
+    void onPacket(AsyncUDPPacket &packet)
+    {
+        uint64_t rxUs = clockUs();
+        uint8_t reply[SyncProtocol::MAX_PACKET];
+
+        portENTER_CRITICAL(&schedulerLock);
+        size_t replyLen = SyncProtocol::handleRobotPacket(packet.data(), packet.length(), rxUs, clockUs,
+                                                          reply, sizeof(reply));
+        portEXIT_CRITICAL(&schedulerLock);
+
+        if (replyLen > 0)
+            packet.write(reply, replyLen);
+
+        wakePowerLoop();
+    }
+}
+
+bool initChoreography()
+{
+    SyncProtocol::resetScheduler();
+
+    listening = udp.listen(RobotConst::SYNC_UDP_PORT);
+    if (!listening)
+    {
+        Serial.println("[ERROR] Choreography UDP listen failed");
+        return false;
+    }
+
+    udp.onPacket(onPacket);
+    Serial.print("[INFO] Choreography listening on UDP ");
+    Serial.println(RobotConst::SYNC_UDP_PORT);
+    return true;
+}
+
+bool takeDueChoreographyCommand(SyncProtocol::ScheduledCommand &command)
+{
+    portENTER_CRITICAL(&schedulerLock);
+    bool due = SyncProtocol::takeDueCommand(clockUs(), command);
+    portEXIT_CRITICAL(&schedulerLock);
+    return due;
+}
+
+void noteChoreographyStepBlocked()
+{
+    blockedCount++;
+}
+
+unsigned long getChoreographyDueInMs()
+{
+    portENTER_CRITICAL(&schedulerLock);
+    uint64_t nextUs = SyncProtocol::getNextCommandUs();
+    portEXIT_CRITICAL(&schedulerLock);
+
+    if (nextUs == UINT64_MAX)
+        return RobotConst::NO_DEADLINE_MS;
+
+    uint64_t now = clockUs();
+    if (nextUs <= now)
+        return 0;
+
+    // Rounded down: waking a little early costs one extra pass, late does not.
+    return (unsigned long)((nextUs - now) / 1000);
+}
+
+void appendChoreographyStatus(ResponseWriter &out)
+{
+    portENTER_CRITICAL(&schedulerLock);
+    SyncProtocol::SchedulerStats stats = SyncProtocol::getSchedulerStats();
+    portEXIT_CRITICAL(&schedulerLock);
+
+    appendResponseFormat(out,
+                         ",\"choreo\":{\"listening\":%s,\"received\":%lu,\"executed\":%lu,\"late\":%lu,"
+                         "\"rejected\":%lu,\"blocked\":%lu,\"max_late_us\":%lu}",
+                         listening ? "true" : "false", (unsigned long)stats.received, (unsigned long)stats.executed,
+                         (unsigned long)stats.late, (unsigned long)stats.rejected, (unsigned long)blockedCount,
+                         (unsigned long)stats.maxLatenessUs);
+}
@@ -0,0 +1,16 @@
+#ifndef CHOREOGRAPHY_H
+#define CHOREOGRAPHY_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+#include "sync_protocol.h"
+
+bool initChoreography();
+bool takeDueChoreographyCommand(SyncProtocol::ScheduledCommand &command);
+// A due step that was dropped because a web client holds control.
+void noteChoreographyStepBlocked();
+unsigned long getChoreographyDueInMs();
+void appendChoreographyStatus(ResponseWriter &out);
+
+#endif
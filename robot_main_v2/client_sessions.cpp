@@ -0,0 +1,243 @@
+#include <IPAddress.h>
+
+#include "client_sessions.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr int32_t TOKEN_SCALE = 1000;
+    constexpr int32_t TOKEN_CAPACITY = RobotConst::CMD_BURST * TOKEN_SCALE;
+
+    struct ClientSession
+    {
+        bool inUse;
+        uint32_t ip;
+        unsigned long lastSeenMs;
+        unsigned long lastCommandMs;
+        unsigned long lastRefillMs;
+        int32_t tokens;
+        bool hasPending;
+        SessionCommand pending;
+        uint32_t requests;
+        uint32_t applied;
+        uint32_t coalesced;
+        uint32_t dropped;
+    };
+
+    ClientSession sessions[RobotConst::MAX_CLIENT_SESSIONS];
+    int ownerIndex = -1;
+
+    void copyField(char *dest, size_t destSize, const char *src)
+    {
+        strncpy(dest, src, destSize - 1);
+        dest[destSize - 1] = '\0';
+    }
+
+    void refillTokens(ClientSession &session, unsigned long now)
+    {
+        unsigned long elapsed = now - session.lastRefillMs;
+        session.lastRefillMs = now;
+
+        int32_t refill = (int32_t)min<unsigned long>(elapsed * RobotConst::CMD_RATE_PER_SEC, TOKEN_CAPACITY);
+        session.tokens = min(session.tokens + refill, TOKEN_CAPACITY);
+    }
+
+    bool takeToken(ClientSession &session, unsigned long now)
+    {
+        refillTokens(session, now);
+        if (session.tokens < TOKEN_SCALE)
+            return false;
+
+        session.tokens -= TOKEN_SCALE;
+        return true;
+    }
+
+    bool isOwnerActive(unsigned long now)
+    {
+        if (ownerIndex < 0)
+            return false;
+
+        return now - sessions[ownerIndex].lastCommandMs < RobotConst::OWNER_TIMEOUT_MS;
+    }
+
+    int findOrCreateSession(uint32_t ip, unsigned long now)
+    {
+        int freeIndex = -1;
+        int oldestIndex = -1;
+
+        for (int i = 0; i < RobotConst::MAX_CLIENT_SESSIONS; i++)
+        {
+            ClientSession &session = sessions[i];
+            if (session.inUse && session.ip == ip)
+                return i;
+
+            if (session.inUse && now - session.lastSeenMs >= RobotConst::SESSION_IDLE_MS && i != ownerIndex)
+                session.inUse = false;
+
+            if (!session.inUse)
+            {
+                if (freeIndex < 0)
+                    freeIndex = i;
+            }
+            else if (i != ownerIndex && (oldestIndex < 0 || session.lastSeenMs < sessions[oldestIndex].lastSeenMs))
+            {
+                oldestIndex = i;
+            }
+        }
+
+        int index = freeIndex >= 0 ? freeIndex : oldestIndex;
+        ClientSession &session = sessions[index];
+        memset(&session, 0, sizeof(session));
+        session.inUse = true;
+        session.ip = ip;
+        session.lastRefillMs = now;
+        session.tokens = TOKEN_CAPACITY;
+        return index;
+    }
+
+    // Hands control to the session unless another owner is still active.
+    bool claimControl(int index, unsigned long now)
+    {
+        ClientSession &session = sessions[index];
+        if (ownerIndex != index)
+        {
+            if (isOwnerActive(now))
+                return false;
+
+            if (ownerIndex >= 0)
+                sessions[ownerIndex].hasPending = false;
+
+            ownerIndex = index;
+            Serial.print("[INFO] Control owner: ");
+            Serial.println(IPAddress(session.ip));
+        }
+
+        session.lastCommandMs = now;
+        return true;
+    }
+}
+
+void initClientSessions()
+{
+    memset(sessions, 0, sizeof(sessions));
+    ownerIndex = -1;
+}
+
+void noteClientRequest(uint32_t clientIp)
+{
+    unsigned long now = millis();
+    ClientSession &session = sessions[findOrCreateSession(clientIp, now)];
+    session.lastSeenMs = now;
+    session.requests++;
+}
+
+SessionAdmission admitClientCommand(uint32_t clientIp, const char *target, const char *action, int speed)
+{
+    unsigned long now = millis();
+    int index = findOrCreateSession(clientIp, now);
+    ClientSession &session = sessions[index];
+    session.lastSeenMs = now;
+    session.requests++;
+
+    if (!claimControl(index, now))
+    {
+        session.dropped++;
+        return SESSION_READ_ONLY;
+    }
+
+    if (!session.hasPending && takeToken(session, now))
+    {
+        session.applied++;
+        return SESSION_APPLY;
+    }
+
+    if (session.hasPending)
+        session.dropped++;
+
+    copyField(session.pending.target, sizeof(session.pending.target), target);
+    copyField(session.pending.action, sizeof(session.pending.action), action);
+    session.pending.speed = speed;
+    session.hasPending = true;
+    session.coalesced++;
+    return SESSION_COALESCED;
+}
+
+SessionAdmission admitClientBatch(uint32_t clientIp)
+{
+    unsigned long now = millis();
+    int index = findOrCreateSession(clientIp, now);
+    ClientSession &session = sessions[index];
+    session.lastSeenMs = now;
+    session.requests++;
+
+    if (!claimControl(index, now))
+    {
+        session.dropped++;
+        return SESSION_READ_ONLY;
+    }
+
+    if (session.hasPending || !takeToken(session, now))
+    {
+        session.dropped++;
+        return SESSION_RATE_LIMITED;
+    }
+
+    session.applied++;
+    return SESSION_APPLY;
+}
+
+bool takeCoalescedCommand(SessionCommand &command)
+{
+    if (ownerIndex < 0)
+        return false;
+
+    ClientSession &session = sessions[ownerIndex];
+    if (!session.hasPending || !takeToken(session, millis()))
+        return false;
+
+    command = session.pending;
+    session.hasPending = false;
+    session.applied++;
+    return true;
+}
+
+void releaseClientControl(uint32_t clientIp)
+{
+    if (ownerIndex < 0 || sessions[ownerIndex].ip != clientIp)
+        return;
+
+    sessions[ownerIndex].hasPending = false;
+    ownerIndex = -1;
+}
+
+uint32_t getControllingClientIp()
+{
+    if (!isOwnerActive(millis()))
+        return 0;
+
+    return sessions[ownerIndex].ip;
+}
+
+void appendSessionStatus(ResponseWriter &out)
+{
+    unsigned long now = millis();
+    bool ownerActive = isOwnerActive(now);
+    bool first = true;
+
+    appendResponse(out, ",\"clients\":[");
+    for (int i = 0; i < RobotConst::MAX_CLIENT_SESSIONS; i++)
+    {
+        const ClientSession &session = sessions[i];
+        if (!session.inUse)
+            continue;
+
+        appendResponse(out, first ? "{\"ip\":" : ",{\"ip\":");
+        appendJsonIp(out, session.ip);
+        appendResponseFormat(out, ",\"owner\":%s,\"req\":%lu,\"applied\":%lu,\"coalesced\":%lu,\"dropped\":%lu}",
+                             (ownerActive && i == ownerIndex) ? "true" : "false",
+                             (unsigned long)session.requests, (unsigned long)session.applied,
+                             (unsigned long)session.coalesced, (unsigned long)session.dropped);
+        first = false;
+    }
+    appendResponse(out, "]");
+}
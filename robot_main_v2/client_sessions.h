@@ -0,0 +1,34 @@
+#ifndef CLIENT_SESSIONS_H
+#define CLIENT_SESSIONS_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+enum SessionAdmission
+{
+    SESSION_APPLY,
+    SESSION_COALESCED,
+    SESSION_READ_ONLY,
+    SESSION_RATE_LIMITED
+};
+
+struct SessionCommand
+{
+    char target[16];
+    char action[24];
+    int speed;
+};
+
+void initClientSessions();
+void noteClientRequest(uint32_t clientIp);
+SessionAdmission admitClientCommand(uint32_t clientIp, const char *target, const char *action, int speed);
+// A batch costs one token like a single command but is never coalesced:
+// it is refused while out of tokens or while a coalesced command waits.
+SessionAdmission admitClientBatch(uint32_t clientIp);
+bool takeCoalescedCommand(SessionCommand &command);
+void releaseClientControl(uint32_t clientIp);
+uint32_t getControllingClientIp();
+void appendSessionStatus(ResponseWriter &out);
+
+#endif
@@ -18,8 +18,12 @@ namespace
     int chargeLevel = 0;
     int prevChargeLevel = -1;
     bool charging = true;
+    bool highlighted = false;
     unsigned long lastChargeStep = 0;
 
+    // initGaugeDisplay() runs on a boot task; nothing draws before it ends.
+    volatile bool displayReady = false;
+
     void drawSun(int cx, int cy, uint16_t color)
     {
         tft.fillCircle(cx, cy, 7, color);
@@ -38,7 +42,8 @@ namespace
     {
         int y = RobotConst::BAR_AREA_Y + index * (RobotConst::BAR_H + RobotConst::BAR_GAP);
         if (filled)
-            tft.fillRect(RobotConst::BAR_AREA_X, y, RobotConst::BAR_W, RobotConst::BAR_H, RobotConst::WALLE_GREEN);
+            tft.fillRect(RobotConst::BAR_AREA_X, y, RobotConst::BAR_W, RobotConst::BAR_H,
+                         highlighted ? RobotConst::WALLE_BRIGHT : RobotConst::WALLE_GREEN);
         else
         {
             tft.fillRect(RobotConst::BAR_AREA_X, y, RobotConst::BAR_W, RobotConst::BAR_H, RobotConst::BLACK);
@@ -77,10 +82,19 @@ void initGaugeDisplay()
     tft.initR(INITR_BLACKTAB);
     tft.setRotation(2);
     drawGaugeFrame();
+    displayReady = true;
+}
+
+bool isGaugeDisplayReady()
+{
+    return displayReady;
 }
 
 void updateCharge()
 {
+    if (!displayReady)
+        return;
+
     unsigned long now = millis();
     if (now - lastChargeStep < RobotConst::CHARGE_INTERVAL)
         return;
@@ -117,3 +131,36 @@ void updateCharge()
         prevChargeLevel = chargeLevel;
     }
 }
+
+// Redraws only the filled bars, in the bright color while highlighted.
+void setGaugeHighlight(bool on)
+{
+    if (on == highlighted || !displayReady)
+        return;
+
+    highlighted = on;
+    for (int i = RobotConst::NUM_BARS - prevChargeLevel; i < RobotConst::NUM_BARS; i++)
+        drawBar(i, true);
+}
+
+int getChargeLevel()
+{
+    return chargeLevel;
+}
+
+bool isChargeRising()
+{
+    return charging;
+}
+
+unsigned long getChargeUpdateDueInMs()
+{
+    if (!displayReady)
+        return RobotConst::NO_DEADLINE_MS;
+
+    unsigned long elapsed = millis() - lastChargeStep;
+    if (elapsed >= RobotConst::CHARGE_INTERVAL)
+        return 0;
+
+    return RobotConst::CHARGE_INTERVAL - elapsed;
+}
@@ -2,6 +2,11 @@
 #define DISPLAY_GAUGE_H
 
 void initGaugeDisplay();
+bool isGaugeDisplayReady();
 void updateCharge();
+unsigned long getChargeUpdateDueInMs();
+void setGaugeHighlight(bool on);
+int getChargeLevel();
+bool isChargeRising();
 
 #endif
@@ -0,0 +1,397 @@
+/**
+ * Audio Tool — checks and feeds the firmware's audio decoder and mixer
+ *
+ *   check                     round-trips test signals through IMA ADPCM,
+ *                             checks chunked decoding, the mixer and every
+ *                             built-in clip
+ *   encode <in.wav> <name>    prints a 16 kHz mono 16-bit WAV as an ADPCM
+ *                             array for audio_clips.cpp
+ *   render <out.wav> <clip> [<clip>]
+ *                             mixes built-in clips started together, the way
+ *                             the robot plays them, into a WAV to listen to
+ *
+ * The encoder picks, for every sample, the nibble whose decoded value lands
+ * closest to the input, running the firmware's own decoder; encoder and
+ * decoder therefore never disagree on the step state.
+ *
+ * Exits non-zero if a check fails or a file cannot be read or written.
+ */
+
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "audio_clips.h"
+#include "audio_mixer.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr double PI = 3.14159265358979323846;
+    constexpr int RATE = (int)RobotConst::AUDIO_SAMPLE_RATE;
+
+    // Two voices at this peak sum to full scale without clipping.
+    constexpr int CLIP_PEAK_LIMIT = 16384;
+
+    int failures = 0;
+
+    void expect(bool ok, const char *what)
+    {
+        printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok)
+            failures++;
+    }
+
+    std::vector<uint8_t> encodeAdpcm(const std::vector<int16_t> &samples)
+    {
+        std::vector<uint8_t> out((samples.size() + 1) / 2, 0);
+        AdpcmState state = {};
+
+        for (size_t i = 0; i < samples.size(); i++)
+        {
+            uint8_t best = 0;
+            long bestError = -1;
+            for (uint8_t nibble = 0; nibble < 16; nibble++)
+            {
+                AdpcmState trial = state;
+                long error = labs((long)decodeAdpcmSample(trial, nibble) - samples[i]);
+                if (bestError < 0 || error < bestError)
+                {
+                    best = nibble;
+                    bestError = error;
+                }
+            }
+
+            decodeAdpcmSample(state, best);
+            out[i / 2] |= (i & 1) ? (uint8_t)(best << 4) : best;
+        }
+        return out;
+    }
+
+    std::vector<int16_t> decodeWhole(const std::vector<uint8_t> &data, size_t count)
+    {
+        std::vector<int16_t> out(count);
+        AdpcmState state = {};
+        decodeAdpcm(data.data(), 0, (int)count, state, out.data());
+        return out;
+    }
+
+    double snrDb(const std::vector<int16_t> &reference, const std::vector<int16_t> &decoded)
+    {
+        double signal = 0.0;
+        double noise = 0.0;
+        for (size_t i = 0; i < reference.size(); i++)
+        {
+            double error = (double)decoded[i] - reference[i];
+            signal += (double)reference[i] * reference[i];
+            noise += error * error;
+        }
+        if (noise == 0.0)
+            return 999.0;
+        return 10.0 * log10(signal / noise);
+    }
+
+    std::vector<int16_t> makeSignal(const char *kind, int count)
+    {
+        std::vector<int16_t> out(count);
+        double phase = 0.0;
+        for (int i = 0; i < count; i++)
+        {
+            double t = (double)i / RATE;
+            double value = 0.0;
+            if (strcmp(kind, "sine") == 0)
+            {
+                value = 0.5 * sin(2 * PI * 440 * t);
+            }
+            else if (strcmp(kind, "chirp") == 0)
+            {
+                phase += 2 * PI * (200 + 3800 * (double)i / count) / RATE;
+                value = 0.5 * sin(phase);
+            }
+            else if (strcmp(kind, "square") == 0)
+            {
+                value = fmod(t * 500, 1.0) < 0.5 ? 0.3 : -0.3;
+            }
+            out[i] = (int16_t)lrint(value * 32767);
+        }
+        return out;
+    }
+
+    AudioClip makeClip(const char *name, const std::vector<uint8_t> &data, size_t count)
+    {
+        return AudioClip{name, name, AUDIO_IMA_ADPCM, data.data(), (uint32_t)count};
+    }
+
+    // Mixes until every voice is done; returns the rendered samples.
+    std::vector<int16_t> renderAll(int maxBlocks)
+    {
+        std::vector<int16_t> out;
+        int16_t block[RobotConst::AUDIO_BLOCK_FRAMES];
+        for (int i = 0; i < maxBlocks; i++)
+        {
+            int active = mixAudioBlock(block, RobotConst::AUDIO_BLOCK_FRAMES);
+            out.insert(out.end(), block, block + RobotConst::AUDIO_BLOCK_FRAMES);
+            if (active == 0)
+                break;
+        }
+        return out;
+    }
+
+    void checkRoundTrip()
+    {
+        printf("round trip (%d Hz, 1 s each)\n", RATE);
+        const struct
+        {
+            const char *kind;
+            double minSnrDb;
+        } SIGNALS[] = {{"sine", 28.0}, {"chirp", 18.0}, {"square", 6.0}, {"silence", 999.0}};
+
+        for (const auto &signal : SIGNALS)
+        {
+            std::vector<int16_t> reference = makeSignal(signal.kind, RATE);
+            std::vector<int16_t> decoded = decodeWhole(encodeAdpcm(reference), reference.size());
+            double snr = snrDb(reference, decoded);
+
+            char what[64];
+            snprintf(what, sizeof(what), "%-8s snr %6.1f dB (min %.0f)", signal.kind, snr, signal.minSnrDb);
+            expect(snr >= signal.minSnrDb, what);
+        }
+    }
+
+    void checkChunkedDecode()
+    {
+        printf("chunked decode\n");
+        std::vector<int16_t> reference = makeSignal("chirp", 5000);
+        std::vector<uint8_t> data = encodeAdpcm(reference);
+        std::vector<int16_t> whole = decodeWhole(data, reference.size());
+
+        for (int chunk : {1, 7, RobotConst::AUDIO_BLOCK_FRAMES})
+        {
+            std::vector<int16_t> pieces(reference.size());
+            AdpcmState state = {};
+            for (size_t first = 0; first < reference.size(); first += (size_t)chunk)
+            {
+                int count = (int)std::min<size_t>((size_t)chunk, reference.size() - first);
+                decodeAdpcm(data.data(), (uint32_t)first, count, state, pieces.data() + first);
+            }
+
+            char what[64];
+            snprintf(what, sizeof(what), "%d-sample chunks match whole decode", chunk);
+            expect(pieces == whole, what);
+        }
+    }
+
+    void checkMixer()
+    {
+        printf("mixer\n");
+        std::vector<int16_t> loud(RATE / 4);
+        for (size_t i = 0; i < loud.size(); i++)
+            loud[i] = (i / 16) % 2 ? 30000 : -30000;
+        std::vector<uint8_t> loudData = encodeAdpcm(loud);
+        AudioClip loudClip = makeClip("loud", loudData, loud.size());
+
+        resetAudioMixer();
+        startAudioVoice(&loudClip);
+        startAudioVoice(&loudClip);
+        std::vector<int16_t> mixed = renderAll(100);
+
+        std::vector<int16_t> single = decodeWhole(loudData, loud.size());
+        bool saturated = true;
+        for (size_t i = 0; i < loud.size(); i++)
+        {
+            int32_t expected = std::max(-32768, std::min(32767, 2 * (int32_t)single[i]));
+            saturated = saturated && mixed[i] == expected;
+        }
+        expect(saturated, "two loud voices saturate instead of wrapping");
+        expect(getAudioMixerStats().clippedSamples > 0, "clipped samples are counted");
+
+        bool silentTail = true;
+        for (size_t i = loud.size(); i < mixed.size(); i++)
+            silentTail = silentTail && mixed[i] == 0;
+        expect(silentTail, "output is silent after the clips end");
+        expect(getAudioMixerStats().completed == 2 && countActiveAudioVoices() == 0, "both voices complete");
+
+        std::vector<int16_t> tone = makeSignal("sine", RATE / 2);
+        std::vector<uint8_t> toneData = encodeAdpcm(tone);
+        AudioClip first = makeClip("first", toneData, tone.size());
+        AudioClip second = makeClip("second", toneData, tone.size() / 2);
+        AudioClip third = makeClip("third", toneData, tone.size() / 4);
+
+        resetAudioMixer();
+        startAudioVoice(&first);
+        startAudioVoice(&second);
+        startAudioVoice(&third);
+        std::vector<int16_t> stolen = renderAll(100);
+        expect(getAudioMixerStats().stolen == 1, "third start steals a voice");
+        expect(stolen.size() < tone.size(), "the earliest voice is the one stolen");
+    }
+
+    void checkBuiltInClips()
+    {
+        printf("built-in clips\n");
+        for (int id = 0; id < AUDIO_CLIP_COUNT; id++)
+        {
+            const AudioClip &clip = AUDIO_CLIPS[id];
+            resetAudioMixer();
+            startAudioVoice(&clip);
+            std::vector<int16_t> rendered = renderAll(1000);
+
+            int peak = 0;
+            for (int16_t sample : rendered)
+                peak = std::max(peak, abs((int)sample));
+
+            char what[96];
+            snprintf(what, sizeof(what), "%-6s %-5s %5.2f s  peak %5d  id %d", clip.name,
+                     clip.format == AUDIO_IMA_ADPCM ? "adpcm" : "pcm", (double)clip.sampleCount / RATE, peak, id);
+            expect(getAudioMixerStats().completed == 1 && peak <= CLIP_PEAK_LIMIT && findAudioClip(clip.name) == id,
+                   what);
+        }
+        expect(findAudioClip("no_such_clip") < 0, "unknown names are not found");
+    }
+
+    bool readWav(const char *path, std::vector<int16_t> &samples)
+    {
+        FILE *file = fopen(path, "rb");
+        if (file == nullptr)
+        {
+            perror(path);
+            return false;
+        }
+
+        std::vector<uint8_t> bytes;
+        uint8_t buffer[4096];
+        size_t got;
+        while ((got = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            bytes.insert(bytes.end(), buffer, buffer + got);
+        fclose(file);
+
+        auto u16 = [&](size_t at) { return (uint32_t)(bytes[at] | (bytes[at + 1] << 8)); };
+        auto u32 = [&](size_t at) { return u16(at) | (u16(at + 2) << 16); };
+
+        if (bytes.size() < 12 || memcmp(bytes.data(), "RIFF", 4) != 0 || memcmp(bytes.data() + 8, "WAVE", 4) != 0)
+        {
+            fprintf(stderr, "%s: not a WAV file\n", path);
+            return false;
+        }
+
+        bool formatOk = false;
+        for (size_t at = 12; at + 8 <= bytes.size();)
+        {
+            uint32_t size = u32(at + 4);
+            if (memcmp(bytes.data() + at, "fmt ", 4) == 0 && size >= 16)
+            {
+                formatOk = u16(at + 8) == 1 && u16(at + 10) == 1 && u32(at + 12) == (uint32_t)RATE &&
+                           u16(at + 22) == 16;
+            }
+            else if (memcmp(bytes.data() + at, "data", 4) == 0 && formatOk)
+            {
+                size = std::min<uint32_t>(size, (uint32_t)(bytes.size() - at - 8));
+                for (uint32_t i = 0; i + 1 < size; i += 2)
+                    samples.push_back((int16_t)u16(at + 8 + i));
+                return true;
+            }
+            at += 8 + size + (size & 1);
+        }
+
+        fprintf(stderr, "%s: expected %d Hz mono 16-bit PCM\n", path, RATE);
+        return false;
+    }
+
+    bool writeWav(const char *path, const std::vector<int16_t> &samples)
+    {
+        FILE *file = fopen(path, "wb");
+        if (file == nullptr)
+        {
+            perror(path);
+            return false;
+        }
+
+        uint32_t dataBytes = (uint32_t)samples.size() * 2;
+        uint8_t header[44];
+        auto put16 = [&](int at, uint32_t v) { header[at] = (uint8_t)v; header[at + 1] = (uint8_t)(v >> 8); };
+        auto put32 = [&](int at, uint32_t v) { put16(at, v & 0xFFFF); put16(at + 2, v >> 16); };
+        memcpy(header, "RIFF", 4);
+        put32(4, 36 + dataBytes);
+        memcpy(header + 8, "WAVEfmt ", 8);
+        put32(16, 16);
+        put16(20, 1);
+        put16(22, 1);
+        put32(24, (uint32_t)RATE);
+        put32(28, (uint32_t)RATE * 2);
+        put16(32, 2);
+        put16(34, 16);
+        memcpy(header + 36, "data", 4);
+        put32(40, dataBytes);
+
+        fwrite(header, 1, sizeof(header), file);
+        for (int16_t sample : samples)
+        {
+            uint8_t raw[2] = {(uint8_t)sample, (uint8_t)((uint16_t)sample >> 8)};
+            fwrite(raw, 1, 2, file);
+        }
+        return fclose(file) == 0;
+    }
+
+    int runEncode(const char *path, const char *name)
+    {
+        std::vector<int16_t> samples;
+        if (!readWav(path, samples))
+            return 1;
+
+        std::vector<uint8_t> data = encodeAdpcm(samples);
+        printf("    // %s: %zu samples, %.2f s\n", name, samples.size(), (double)samples.size() / RATE);
+        printf("    const uint8_t %s[] = {", name);
+        for (size_t i = 0; i < data.size(); i++)
+            printf("%s0x%02x,", i % 16 == 0 ? "\n        " : " ", data[i]);
+        printf("\n    };\n");
+        return 0;
+    }
+
+    int runRender(const char *path, int clipCount, char **clipNames)
+    {
+        resetAudioMixer();
+        for (int i = 0; i < clipCount; i++)
+        {
+            int id = findAudioClip(clipNames[i]);
+            if (id < 0)
+            {
+                fprintf(stderr, "unknown clip: %s\n", clipNames[i]);
+                return 2;
+            }
+            startAudioVoice(&AUDIO_CLIPS[id]);
+        }
+
+        std::vector<int16_t> rendered = renderAll(1000);
+        printf("%s: %zu samples, clipped %u\n", path, rendered.size(), getAudioMixerStats().clippedSamples);
+        return writeWav(path, rendered) ? 0 : 1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string command = argc > 1 ? argv[1] : "";
+
+    if (command == "check" && argc == 2)
+    {
+        checkRoundTrip();
+        checkChunkedDecode();
+        checkMixer();
+        checkBuiltInClips();
+        printf("\nfailures=%d\n", failures);
+        return failures == 0 ? 0 : 1;
+    }
+    if (command == "encode" && argc == 4)
+        return runEncode(argv[2], argv[3]);
+    if (command == "render" && argc >= 4 && argc <= 3 + RobotConst::AUDIO_VOICES)
+        return runRender(argv[2], argc - 3, argv + 3);
+
+    fprintf(stderr, "usage: %s check\n"
+                    "       %s encode <in.wav> <name>\n"
+                    "       %s render <out.wav> <clip> [<clip>]\n",
+            argv[0], argv[0], argv[0]);
+    return 2;
+}
@@ -0,0 +1,66 @@
+// Audio mixer: ADPCM decoding and one mix block with 0..AUDIO_VOICES voices,
+// i.e. the audio task's work per DMA buffer.
+
+#include <Arduino.h>
+
+#include "audio_clips.h"
+#include "audio_mixer.h"
+#include "bench_counters.h"
+#include "robot_constants.h"
+
+namespace
+{
+    // Longest built-in ADPCM clip, restarted whenever it runs out.
+    const AudioClip &longestAdpcmClip()
+    {
+        int longest = 0;
+        for (int id = 0; id < AUDIO_CLIP_COUNT; id++)
+        {
+            if (AUDIO_CLIPS[id].format == AUDIO_IMA_ADPCM &&
+                AUDIO_CLIPS[id].sampleCount > AUDIO_CLIPS[longest].sampleCount)
+                longest = id;
+        }
+        return AUDIO_CLIPS[longest];
+    }
+
+    void BM_DecodeAdpcmBlock(benchmark::State &state)
+    {
+        const AudioClip &clip = longestAdpcmClip();
+        int16_t out[RobotConst::AUDIO_BLOCK_FRAMES];
+        AdpcmState adpcm = {};
+        uint32_t position = 0;
+
+        for (auto _ : state)
+        {
+            if (position + RobotConst::AUDIO_BLOCK_FRAMES > clip.sampleCount)
+            {
+                position = 0;
+                adpcm = AdpcmState();
+            }
+            decodeAdpcm(clip.data, position, RobotConst::AUDIO_BLOCK_FRAMES, adpcm, out);
+            position += RobotConst::AUDIO_BLOCK_FRAMES;
+            benchmark::DoNotOptimize(out);
+        }
+
+        state.SetItemsProcessed(state.iterations() * RobotConst::AUDIO_BLOCK_FRAMES);
+    }
+    BENCHMARK(BM_DecodeAdpcmBlock);
+
+    void BM_MixAudioBlock(benchmark::State &state)
+    {
+        const AudioClip &clip = longestAdpcmClip();
+        int voices = (int)state.range(0);
+        int16_t out[RobotConst::AUDIO_BLOCK_FRAMES];
+
+        resetAudioMixer();
+        for (auto _ : state)
+        {
+            while (countActiveAudioVoices() < voices)
+                startAudioVoice(&clip);
+            benchmark::DoNotOptimize(mixAudioBlock(out, RobotConst::AUDIO_BLOCK_FRAMES));
+        }
+
+        state.SetItemsProcessed(state.iterations() * RobotConst::AUDIO_BLOCK_FRAMES);
+    }
+    BENCHMARK(BM_MixAudioBlock)->DenseRange(0, RobotConst::AUDIO_VOICES);
+}
@@ -0,0 +1,27 @@
+#ifndef BENCH_COUNTERS_H
+#define BENCH_COUNTERS_H
+
+#include <benchmark/benchmark.h>
+
+#include "host_hw.h"
+
+// Hardware operations issued during a benchmark loop, reported per call so
+// they sit next to the timing in the JSON output.
+inline void resetHardwareCounters()
+{
+    HostHw::resetCounters();
+}
+
+inline void reportHardwareCounters(benchmark::State &state)
+{
+    const HostHw::Counters &counters = HostHw::counters();
+    const auto perCall = benchmark::Counter::kAvgIterations;
+
+    state.counters["gpio_writes"] = benchmark::Counter((double)counters.gpioWrites, perCall);
+    state.counters["pwm_writes"] = benchmark::Counter((double)counters.pwmWrites, perCall);
+    state.counters["i2c_bytes"] = benchmark::Counter((double)counters.i2cBytes, perCall);
+    state.counters["spi_windows"] = benchmark::Counter((double)counters.spiWindows, perCall);
+    state.counters["spi_pixels"] = benchmark::Counter((double)counters.spiPixels, perCall);
+}
+
+#endif
@@ -0,0 +1,53 @@
+// drawSun lives in the module's anonymous namespace, so the module is
+// compiled into this translation unit to reach it.
+
+#include "../display_gauge.cpp"
+
+#include "bench_counters.h"
+
+namespace
+{
+    // Each call is a due tick: the level moves one bar and only the changed
+    // bar is redrawn.
+    void BM_UpdateCharge(benchmark::State &state)
+    {
+        initGaugeDisplay();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            HostHw::advanceUs(RobotConst::CHARGE_INTERVAL * 1000ULL);
+            updateCharge();
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateCharge);
+
+    // Not due yet: the early return taken on most loop ticks.
+    void BM_UpdateCharge_NotDue(benchmark::State &state)
+    {
+        initGaugeDisplay();
+        HostHw::advanceUs(RobotConst::CHARGE_INTERVAL * 1000ULL);
+        updateCharge();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+            updateCharge();
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateCharge_NotDue);
+
+    void BM_DrawSun(benchmark::State &state)
+    {
+        initGaugeDisplay();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+            drawSun(RobotConst::SUN_CX, RobotConst::SUN_CY, RobotConst::WALLE_GREEN);
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_DrawSun);
+}
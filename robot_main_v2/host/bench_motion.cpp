@@ -0,0 +1,83 @@
+// driveTank and the web command mapping. Servo and drive modules are linked
+// normally; the servo module itself is compiled through bench_servo.cpp.
+
+#include <Arduino.h>
+
+#include "autonomous_drive.h"
+#include "bench_counters.h"
+#include "motor_control.h"
+#include "robot_commands.h"
+#include "servo_ioc_module.h"
+
+namespace
+{
+    struct BenchCommand
+    {
+        const char *target;
+        const char *action;
+    };
+
+    // First and last branch of each dispatch chain, plus a miss.
+    const BenchCommand COMMANDS[] = {
+        {"motion", "forward"},
+        {"motion", "backward_right"},
+        {"motion", "stop"},
+        {"head", "center"},
+        {"right_arm", "down"},
+        {"system", "autonomous_off"},
+        {"system", "pose_off"},
+        {"lights", "on"},
+    };
+
+    void BM_DriveTank(benchmark::State &state)
+    {
+        initMotors();
+        int speed = (int)state.range(0);
+        resetHardwareCounters();
+
+        bool flip = false;
+        for (auto _ : state)
+        {
+            driveTank(flip ? -speed : speed, speed);
+            flip = !flip;
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_DriveTank)->Arg(0)->Arg(185);
+
+    void BM_MapAndApplyCommand(benchmark::State &state)
+    {
+        const BenchCommand &command = COMMANDS[state.range(0)];
+        initMotors();
+        initServoIOC();
+        initAutonomousDrive();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+            benchmark::DoNotOptimize(mapAndApplyCommand(command.target, command.action, 185));
+
+        reportHardwareCounters(state);
+        state.SetLabel(std::string(command.target) + "/" + command.action);
+    }
+    BENCHMARK(BM_MapAndApplyCommand)->DenseRange(0, sizeof(COMMANDS) / sizeof(COMMANDS[0]) - 1);
+
+    // A three-joint pose as one /batch spec: parse, resolve and apply.
+    void BM_CommandBatch(benchmark::State &state)
+    {
+        initMotors();
+        initServoIOC();
+        initAutonomousDrive();
+        resetHardwareCounters();
+
+        CommandBatch batch;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(parseCommandBatch("head:left,left_arm:up,right_arm:down", 185, batch));
+            applyCommandBatch(batch);
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_CommandBatch);
+}
@@ -0,0 +1,114 @@
+// updateOneServoStep lives in the module's anonymous namespace, so the module
+// is compiled into this translation unit to reach it.
+
+#include "../servo_ioc_module.cpp"
+
+#include "bench_counters.h"
+
+namespace
+{
+    constexpr uint64_t STEP_US = RobotConst::SERVO_STEP_DELAY_MS * 1000ULL;
+
+    // Every servo written once, at rest and released: nothing left in the
+    // active set.
+    void settleAllServos()
+    {
+        HostHw::advanceUs((RobotConst::SERVO_RELEASE_AFTER_MS + 1) * 1000ULL);
+        updateServoIOC();
+    }
+
+    // One degree per call: the clock advances a full step delay each time
+    // and the target flips between the end stops.
+    void BM_UpdateOneServoStep_Moving(benchmark::State &state)
+    {
+        initServoIOC();
+        uint8_t channel = toChannel(RobotConst::HEAD_SERVO_ID);
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            if (currentAngleByChannel[channel] == targetAngleByChannel[channel])
+                targetAngleByChannel[channel] = currentAngleByChannel[channel] == 0 ? 180 : 0;
+
+            HostHw::advanceUs(STEP_US);
+            updateOneServoStep(channel);
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateOneServoStep_Moving);
+
+    // At target and already released.
+    void BM_UpdateOneServoStep_Idle(benchmark::State &state)
+    {
+        initServoIOC();
+        uint8_t channel = toChannel(RobotConst::HEAD_SERVO_ID);
+        HostHw::advanceUs((RobotConst::SERVO_RELEASE_AFTER_MS + 1) * 1000ULL);
+        updateOneServoStep(channel);
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            HostHw::advanceUs(STEP_US);
+            updateOneServoStep(channel);
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateOneServoStep_Idle);
+
+    // The common case on every loop tick: the whole bank configured and at
+    // rest. Only the active-set words are read, however many servos exist.
+    void BM_UpdateServoIOC_BankIdle(benchmark::State &state)
+    {
+        initServoIOC();
+        for (int id = 1; id <= RobotConst::SERVO_BANK_SIZE; id++)
+            setServoAngle(id, 90);
+        settleAllServos();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            HostHw::advanceUs(STEP_US);
+            updateServoIOC();
+        }
+
+        state.counters["active"] = countActiveServos();
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateServoIOC_BankIdle);
+
+    // Cost grows with the servos actually sweeping, not with bank size.
+    // The sweep stays inside the arm limits, which setServoAngle applies to
+    // the arm IDs, so every channel keeps moving.
+    void BM_UpdateServoIOC_Moving(benchmark::State &state)
+    {
+        constexpr int SWEEP_LOW = RobotConst::ARM_ANGLE_MIN;
+        constexpr int SWEEP_HIGH = RobotConst::ARM_ANGLE_MAX;
+
+        int moving = (int)state.range(0);
+        initServoIOC();
+        for (int id = 1; id <= RobotConst::SERVO_BANK_SIZE; id++)
+            setServoAngle(id, 90);
+        settleAllServos();
+        for (int id = 1; id <= moving; id++)
+            setServoAngle(id, SWEEP_LOW);
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            for (int id = 1; id <= moving; id++)
+            {
+                int angle = getServoAngle(id);
+                if (angle == SWEEP_LOW || angle == SWEEP_HIGH)
+                    setServoAngle(id, angle == SWEEP_LOW ? SWEEP_HIGH : SWEEP_LOW);
+            }
+
+            HostHw::advanceUs(STEP_US);
+            updateServoIOC();
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateServoIOC_Moving)->Arg(1)->Arg(3)->Arg(8)->Arg(RobotConst::SERVO_BANK_SIZE);
+}
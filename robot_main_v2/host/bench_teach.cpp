@@ -0,0 +1,66 @@
+// Teach and repeat: what recording adds to a web command, and the replay
+// tick with the next step far ahead.
+
+#include <Arduino.h>
+
+#include "bench_counters.h"
+#include "robot_constants.h"
+#include "teach_mode.h"
+
+namespace
+{
+    const RobotCommand DRIVE_COMMAND = {COMMAND_DRIVE, 185, 185, "DRIVE FORWARD"};
+
+    void BM_NoteManualCommand_Idle(benchmark::State &state)
+    {
+        initTeachMode();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+            noteManualCommand(DRIVE_COMMAND);
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_NoteManualCommand_Idle);
+
+    // Includes filling the buffer: the flash save that follows runs from
+    // updateTeachMode(), not from the command handler.
+    void BM_NoteManualCommand_Recording(benchmark::State &state)
+    {
+        initTeachMode();
+        startTeachRecording();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            if (!isTeachRecording())
+                startTeachRecording();
+            HostHw::advanceUs(50000);
+            noteManualCommand(DRIVE_COMMAND);
+        }
+
+        reportHardwareCounters(state);
+        stopTeachRecording();
+    }
+    BENCHMARK(BM_NoteManualCommand_Recording);
+
+    void BM_UpdateTeachMode_NothingDue(benchmark::State &state)
+    {
+        initTeachMode();
+        startTeachRecording();
+        noteManualCommand(DRIVE_COMMAND);
+        HostHw::advanceUs(60000000ULL);
+        noteManualCommand(RobotCommand{COMMAND_STOP, 0, 0, "STOP"});
+        stopTeachRecording();
+        startTeachReplay(100);
+        updateTeachMode();
+        resetHardwareCounters();
+
+        for (auto _ : state)
+            updateTeachMode();
+
+        reportHardwareCounters(state);
+        cancelTeachReplay();
+    }
+    BENCHMARK(BM_UpdateTeachMode_NothingDue);
+}
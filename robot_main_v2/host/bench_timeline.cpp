@@ -0,0 +1,55 @@
+// Timeline scheduler: the per-tick cost with events queued far ahead, and a
+// schedule + dispatch round trip on top of a loaded heap.
+
+#include <Arduino.h>
+
+#include "bench_counters.h"
+#include "robot_constants.h"
+#include "timeline.h"
+
+namespace
+{
+    constexpr unsigned long FAR_AHEAD_MS = 3600000;
+
+    void fillFarAhead(int count)
+    {
+        initTimeline();
+        for (int i = 0; i < count; i++)
+        {
+            TimelineEvent event = {millis() + FAR_AHEAD_MS + (unsigned long)i, TIMELINE_SERVO,
+                                   RobotConst::HEAD_SERVO_ID, 90};
+            scheduleTimelineEvent(event);
+        }
+    }
+
+    void BM_UpdateTimeline_NothingDue(benchmark::State &state)
+    {
+        fillFarAhead((int)state.range(0));
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            HostHw::advanceUs(RobotConst::ACTIVE_TICK_MS * 1000ULL);
+            updateTimeline();
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_UpdateTimeline_NothingDue)->Arg(0)->Arg(8)->Arg(RobotConst::TIMELINE_CAPACITY - 1);
+
+    void BM_Timeline_ScheduleAndDispatch(benchmark::State &state)
+    {
+        fillFarAhead((int)state.range(0));
+        resetHardwareCounters();
+
+        for (auto _ : state)
+        {
+            TimelineEvent event = {millis(), TIMELINE_DRIVE, 120, -120};
+            scheduleTimelineEvent(event);
+            updateTimeline();
+        }
+
+        reportHardwareCounters(state);
+    }
+    BENCHMARK(BM_Timeline_ScheduleAndDispatch)->Arg(0)->Arg(RobotConst::TIMELINE_CAPACITY - 1);
+}
@@ -0,0 +1,109 @@
+/**
+ * Channel Pick — replays recorded Wi-Fi scans through channel_select.cpp
+ *
+ * Each file holds one scan, one network per line:
+ *
+ *   <channel>,<rssi_dbm>[,<ssid>]
+ *
+ * Lines starting with # are comments; "# expect: N" names the channel the
+ * firmware should pick for that scan. Prints the per-channel congestion
+ * scores and the pick for every file.
+ *
+ * Usage: channel_pick scan.csv [scan.csv ...]
+ *
+ * Exits non-zero if a pick differs from its expectation or a file is unreadable.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "channel_select.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr int MAX_SAMPLES = 256;
+
+    struct Recording
+    {
+        ScanSample samples[MAX_SAMPLES];
+        int count;
+        int expected;
+    };
+
+    bool loadRecording(const char *path, Recording &recording)
+    {
+        FILE *file = fopen(path, "r");
+        if (file == nullptr)
+        {
+            perror(path);
+            return false;
+        }
+
+        recording.count = 0;
+        recording.expected = 0;
+
+        char line[160];
+        while (fgets(line, sizeof(line), file) != nullptr)
+        {
+            if (line[0] == '#')
+            {
+                sscanf(line, "# expect: %d", &recording.expected);
+                continue;
+            }
+
+            int channel;
+            int rssi;
+            if (sscanf(line, "%d,%d", &channel, &rssi) != 2)
+                continue;
+            if (channel < 1 || channel > 14 || recording.count >= MAX_SAMPLES)
+                continue;
+
+            recording.samples[recording.count++] = {(uint8_t)channel, (int8_t)rssi};
+        }
+
+        fclose(file);
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s scan.csv [scan.csv ...]\n", argv[0]);
+        return 2;
+    }
+
+    static Recording recording;
+    int failures = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!loadRecording(argv[i], recording))
+        {
+            failures++;
+            continue;
+        }
+
+        uint32_t scores[RobotConst::AP_CHANNEL_MAX + 1];
+        scoreChannels(recording.samples, recording.count, scores);
+        uint8_t pick = selectQuietestChannel(recording.samples, recording.count);
+
+        printf("%s (%d networks)\n  ", argv[i], recording.count);
+        for (int channel = 1; channel <= RobotConst::AP_CHANNEL_MAX; channel++)
+            printf(" ch%d=%u", channel, scores[channel]);
+
+        bool matches = recording.expected == 0 || recording.expected == pick;
+        printf("\n   pick=%u", pick);
+        if (recording.expected != 0)
+            printf(" expect=%d %s", recording.expected, matches ? "ok" : "MISMATCH");
+        printf("\n");
+
+        if (!matches)
+            failures++;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
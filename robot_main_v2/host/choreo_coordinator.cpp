@@ -0,0 +1,349 @@
+/**
+ * Choreography Coordinator — drives a group of robots over UDP
+ *
+ * 1. Clock sync: each robot is pinged a few times; the exchange with the
+ *    smallest round trip gives that robot's clock offset (NTP-style).
+ * 2. Each script step is sent LEAD ms ahead as EXEC_AT, converted to every
+ *    robot's own clock, after a quick re-sync so clock drift does not build
+ *    up over a long script. Unacknowledged sends are retried.
+ * 3. Afterwards every robot is asked when it actually executed each step;
+ *    the spread across robots is reported per step.
+ *
+ * Script lines: <time_s> <target> <action> [speed]   (# starts a comment)
+ *
+ * Usage: choreo_coordinator --robot host:port [--robot host:port ...]
+ *                           [--script file] [--lead-ms MS] [--pings N]
+ *                           [--tolerance-ms MS]
+ *
+ * Exits non-zero if a robot misses a step or the worst spread exceeds the
+ * tolerance.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "host_udp.h"
+#include "sync_protocol.h"
+
+using namespace SyncProtocol;
+
+namespace
+{
+    constexpr int64_t REPLY_TIMEOUT_US = 100000;
+    constexpr int SEND_ATTEMPTS = 5;
+    constexpr int RESYNC_PINGS = 4;
+    constexpr int64_t START_DELAY_US = 500000;
+    constexpr int64_t REPORT_GRACE_US = 200000;
+
+    struct Step
+    {
+        double timeS;
+        char target[TARGET_LEN];
+        char action[ACTION_LEN];
+        int speed;
+    };
+
+    struct Robot
+    {
+        std::string name;
+        sockaddr_in address;
+        int64_t offsetUs;
+        int64_t bestDelayUs;
+        bool synced;
+    };
+
+    struct Options
+    {
+        std::vector<std::string> robots;
+        const char *scriptPath = nullptr;
+        int64_t leadUs = 300000;
+        int pings = 8;
+        double toleranceMs = 5.0;
+    };
+
+    const char *const DEMO_SCRIPT[] = {
+        "0.0 system pose_off",
+        "0.5 motion forward 185",
+        "1.0 head left",
+        "1.5 motion right 165",
+        "1.8 left_arm up",
+        "2.0 right_arm up",
+        "2.5 motion stop",
+        "3.0 head center",
+    };
+
+    Options options;
+    int socketFd = -1;
+    uint32_t nextSeq = 0;
+    auto startTime = std::chrono::steady_clock::now();
+
+    uint64_t coordinatorClockUs()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - startTime)
+            .count();
+    }
+
+    void sleepUntil(uint64_t clockUs)
+    {
+        uint64_t now = coordinatorClockUs();
+        if (clockUs > now)
+            std::this_thread::sleep_for(std::chrono::microseconds(clockUs - now));
+    }
+
+    // Sends one request and waits for the matching reply from that robot.
+    bool exchange(const Robot &robot, Packet &request, PacketType replyType, Packet &reply,
+                  uint64_t *receivedUs = nullptr)
+    {
+        for (int attempt = 0; attempt < SEND_ATTEMPTS; attempt++)
+        {
+            uint8_t buffer[MAX_PACKET];
+            if (request.type == PACKET_PING)
+                request.t0 = coordinatorClockUs();
+            size_t len = encodePacket(request, buffer, sizeof(buffer));
+            if (len == 0 || !HostUdp::sendTo(socketFd, robot.address, buffer, len))
+                return false;
+
+            uint64_t deadline = coordinatorClockUs() + REPLY_TIMEOUT_US;
+            while (coordinatorClockUs() < deadline)
+            {
+                sockaddr_in from;
+                long got = HostUdp::receive(socketFd, buffer, sizeof(buffer), from, deadline - coordinatorClockUs());
+                uint64_t arrivedUs = coordinatorClockUs();
+                if (got <= 0 || !HostUdp::sameEndpoint(from, robot.address))
+                    continue;
+                if (!decodePacket(buffer, (size_t)got, reply) || reply.type != replyType || reply.seq != request.seq)
+                    continue;
+
+                if (receivedUs != nullptr)
+                    *receivedUs = arrivedUs;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Keeps the offset from the exchange with the smallest round trip: the
+    // one least disturbed by queueing on either side.
+    void syncRobot(Robot &robot, int pings)
+    {
+        robot.bestDelayUs = INT64_MAX;
+        for (int i = 0; i < pings; i++)
+        {
+            Packet ping = {};
+            ping.type = PACKET_PING;
+            ping.seq = nextSeq++;
+
+            Packet pong;
+            uint64_t t3 = 0;
+            if (!exchange(robot, ping, PACKET_PONG, pong, &t3))
+                continue;
+
+            int64_t offsetUs;
+            int64_t delayUs;
+            computeClockSample(pong, t3, offsetUs, delayUs);
+            if (delayUs < robot.bestDelayUs)
+            {
+                robot.bestDelayUs = delayUs;
+                robot.offsetUs = offsetUs;
+                robot.synced = true;
+            }
+        }
+    }
+
+    bool parseStep(const char *line, Step &step)
+    {
+        step.speed = 185;
+        int fields = sscanf(line, "%lf %15s %23s %d", &step.timeS, step.target, step.action, &step.speed);
+        return fields >= 3;
+    }
+
+    bool loadScript(std::vector<Step> &steps)
+    {
+        char line[128];
+        Step step;
+
+        if (options.scriptPath == nullptr)
+        {
+            for (const char *demoLine : DEMO_SCRIPT)
+            {
+                if (parseStep(demoLine, step))
+                    steps.push_back(step);
+            }
+        }
+        else
+        {
+            FILE *script = fopen(options.scriptPath, "r");
+            if (script == nullptr)
+            {
+                perror(options.scriptPath);
+                return false;
+            }
+
+            while (fgets(line, sizeof(line), script) != nullptr)
+            {
+                char *comment = strchr(line, '#');
+                if (comment != nullptr)
+                    *comment = '\0';
+                if (parseStep(line, step))
+                    steps.push_back(step);
+            }
+            fclose(script);
+        }
+
+        std::stable_sort(steps.begin(), steps.end(), [](const Step &a, const Step &b) { return a.timeS < b.timeS; });
+        return !steps.empty();
+    }
+
+    void parseArgs(int argc, char **argv)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            if (flag == "--robot")
+                options.robots.push_back(argv[i + 1]);
+            else if (flag == "--script")
+                options.scriptPath = argv[i + 1];
+            else if (flag == "--lead-ms")
+                options.leadUs = (int64_t)(atof(argv[i + 1]) * 1000);
+            else if (flag == "--pings")
+                options.pings = std::max(1, atoi(argv[i + 1]));
+            else if (flag == "--tolerance-ms")
+                options.toleranceMs = atof(argv[i + 1]);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    parseArgs(argc, argv);
+
+    std::vector<Robot> robots;
+    for (const std::string &spec : options.robots)
+    {
+        Robot robot = {spec, {}, 0, 0, false};
+        if (!HostUdp::parseAddress(spec.c_str(), robot.address))
+        {
+            fprintf(stderr, "bad robot address: %s (expected ip:port)\n", spec.c_str());
+            return 2;
+        }
+        robots.push_back(robot);
+    }
+
+    std::vector<Step> steps;
+    if (robots.empty() || !loadScript(steps))
+    {
+        fprintf(stderr, "usage: %s --robot ip:port [--robot ip:port ...] [--script file] [--lead-ms MS] "
+                        "[--pings N] [--tolerance-ms MS]\n",
+                argv[0]);
+        return 2;
+    }
+
+    socketFd = HostUdp::open(0);
+    if (socketFd < 0)
+    {
+        perror("socket");
+        return 1;
+    }
+
+    // Sequence numbers must not repeat across runs: robots keep a history
+    // of executed ones to drop retransmissions.
+    nextSeq = (uint32_t)std::chrono::system_clock::now().time_since_epoch().count();
+
+    for (Robot &robot : robots)
+    {
+        syncRobot(robot, options.pings);
+        if (!robot.synced)
+        {
+            fprintf(stderr, "%s: no reply to clock sync\n", robot.name.c_str());
+            return 1;
+        }
+        printf("%-22s offset=%+.3f ms rtt=%.3f ms\n", robot.name.c_str(), robot.offsetUs / 1000.0, robot.bestDelayUs / 1000.0);
+    }
+
+    uint64_t startUs = coordinatorClockUs() + std::max(START_DELAY_US, options.leadUs);
+    std::vector<uint32_t> stepSeqs;
+
+    for (const Step &step : steps)
+    {
+        uint64_t atUs = startUs + (uint64_t)(step.timeS * 1e6);
+        sleepUntil(atUs > (uint64_t)options.leadUs ? atUs - options.leadUs : 0);
+
+        Packet command = {};
+        command.type = PACKET_EXEC_AT;
+        command.seq = nextSeq++;
+        strncpy(command.target, step.target, TARGET_LEN - 1);
+        strncpy(command.action, step.action, ACTION_LEN - 1);
+        command.speed = (int16_t)step.speed;
+        stepSeqs.push_back(command.seq);
+
+        for (Robot &robot : robots)
+        {
+            syncRobot(robot, RESYNC_PINGS);
+            command.at = atUs + robot.offsetUs;
+
+            Packet ack;
+            if (!exchange(robot, command, PACKET_ACK, ack))
+                fprintf(stderr, "%s: no ACK for step %.3f s\n", robot.name.c_str(), step.timeS);
+            else if (ack.result == ACK_LATE)
+                fprintf(stderr, "%s: step %.3f s arrived late, raise --lead-ms\n", robot.name.c_str(), step.timeS);
+            else if (ack.result == ACK_QUEUE_FULL)
+                fprintf(stderr, "%s: queue full at step %.3f s\n", robot.name.c_str(), step.timeS);
+        }
+    }
+
+    sleepUntil(startUs + (uint64_t)(steps.back().timeS * 1e6) + REPORT_GRACE_US);
+
+    printf("\n%-8s %-22s %10s %10s\n", "time_s", "command", "spread_ms", "late_ms");
+    double worstSpreadMs = 0.0;
+    bool allExecuted = true;
+
+    for (size_t i = 0; i < steps.size(); i++)
+    {
+        uint64_t plannedUs = startUs + (uint64_t)(steps[i].timeS * 1e6);
+        int64_t earliest = INT64_MAX;
+        int64_t latest = INT64_MIN;
+
+        for (const Robot &robot : robots)
+        {
+            Packet query = {};
+            query.type = PACKET_REPORT_QUERY;
+            query.seq = stepSeqs[i];
+
+            Packet report;
+            if (!exchange(robot, query, PACKET_REPORT, report) || report.result != REPORT_EXECUTED)
+            {
+                fprintf(stderr, "%s: step %.3f s not executed\n", robot.name.c_str(), steps[i].timeS);
+                allExecuted = false;
+                continue;
+            }
+
+            int64_t executedUs = (int64_t)report.t1 - robot.offsetUs;
+            earliest = std::min(earliest, executedUs);
+            latest = std::max(latest, executedUs);
+        }
+
+        if (earliest > latest)
+            continue;
+
+        double spreadMs = (latest - earliest) / 1000.0;
+        double lateMs = (latest - (int64_t)plannedUs) / 1000.0;
+        worstSpreadMs = std::max(worstSpreadMs, spreadMs);
+
+        char label[TARGET_LEN + ACTION_LEN + 1];
+        snprintf(label, sizeof(label), "%s/%s", steps[i].target, steps[i].action);
+        printf("%-8.3f %-22s %10.3f %10.3f\n", steps[i].timeS, label, spreadMs, lateMs);
+    }
+
+    printf("\nrobots=%zu steps=%zu worst_spread_ms=%.3f tolerance_ms=%.1f\n", robots.size(), steps.size(),
+           worstSpreadMs, options.toleranceMs);
+
+    HostUdp::close(socketFd);
+    return (allExecuted && worstSpreadMs <= options.toleranceMs) ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+/**
+ * Command Load — stresses the robot's HTTP control endpoint
+ *
+ * N simulated clients each start operations at a fixed rate, picked at random
+ * from a weighted mix:
+ *
+ *   motion : a burst of /cmd motion requests back to back, then "stop"
+ *   servo  : a head or arm sweep (e.g. left → center → right)
+ *   status : one GET /status
+ *
+ * Every request is timed from the moment it was due, not from when the client
+ * got round to sending it, so a robot that stalls cannot hide behind a
+ * backed-up client. Results are grouped by operation kind:
+ *
+ *   ok        : 200
+ *   coalesced : 202, rate limited and merged into the owner's pending command
+ *   read_only : 403, another client holds control
+ *   errors    : anything else, including timeouts and refused connections
+ *
+ * On loopback, --source-base gives every client its own 127.x address, so the
+ * robot sees separate sessions. Against a real robot all clients share the
+ * host's IP and therefore one session.
+ *
+ * Usage: cmd_load [--robot ip:port] [--clients N] [--rate OPS_PER_S]
+ *                 [--duration-s S] [--mix motion=W,servo=W,status=W]
+ *                 [--burst N] [--source-base IP] [--timeout-ms MS]
+ *                 [--seed N] [--max-error-pct PCT]
+ *
+ * Exits non-zero if the error rate exceeds --max-error-pct (default 1).
+ */
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "host_http.h"
+#include "host_udp.h"
+
+namespace
+{
+    enum OperationKind
+    {
+        OP_MOTION,
+        OP_SERVO,
+        OP_STATUS,
+        OP_KIND_COUNT
+    };
+
+    const char *const KIND_NAMES[OP_KIND_COUNT] = {"motion", "servo", "status"};
+
+    const char *const MOTION_ACTIONS[] = {"forward", "backward", "left", "right",
+                                          "forward_left", "forward_right", "backward_left", "backward_right"};
+
+    const char *const SERVO_SWEEPS[][4] = {
+        {"head", "left", "center", "right"},
+        {"head", "right", "center", "left"},
+        {"left_arm", "up", "center", "down"},
+        {"right_arm", "up", "center", "down"},
+    };
+
+    struct Options
+    {
+        std::string robot = "192.168.4.1:80";
+        int clients = 4;
+        double rate = 5.0;
+        double durationS = 10.0;
+        int weights[OP_KIND_COUNT] = {60, 25, 15};
+        int burst = 5;
+        const char *sourceBase = nullptr;
+        int64_t timeoutUs = 1000000;
+        unsigned seed = 1;
+        double maxErrorPct = 1.0;
+    };
+
+    struct Tally
+    {
+        uint64_t sent = 0;
+        uint64_t ok = 0;
+        uint64_t coalesced = 0;
+        uint64_t readOnly = 0;
+        uint64_t errors = 0;
+        std::vector<double> latencyMs;
+
+        void merge(const Tally &other)
+        {
+            sent += other.sent;
+            ok += other.ok;
+            coalesced += other.coalesced;
+            readOnly += other.readOnly;
+            errors += other.errors;
+            latencyMs.insert(latencyMs.end(), other.latencyMs.begin(), other.latencyMs.end());
+        }
+    };
+
+    Options options;
+    sockaddr_in robotAddress;
+    std::mutex resultsLock;
+    Tally results[OP_KIND_COUNT];
+    std::atomic<uint64_t> lateStarts{0};
+
+    using Clock = std::chrono::steady_clock;
+
+    class Client
+    {
+    public:
+        Client(int index, Clock::time_point start) : index(index), start(start), random(options.seed * 7919u + index)
+        {
+            if (options.sourceBase != nullptr)
+            {
+                source = {};
+                source.sin_family = AF_INET;
+                inet_pton(AF_INET, options.sourceBase, &source.sin_addr);
+                source.sin_addr.s_addr = htonl(ntohl(source.sin_addr.s_addr) + (uint32_t)index);
+                hasSource = true;
+            }
+        }
+
+        void run()
+        {
+            // Clients start staggered across one period so they do not fire in lockstep.
+            double periodS = 1.0 / options.rate;
+            double offsetS = periodS * index / std::max(1, options.clients);
+            Clock::time_point end = start + toDuration(options.durationS);
+
+            for (int op = 0;; op++)
+            {
+                Clock::time_point due = start + toDuration(offsetS + op * periodS);
+                if (due >= end)
+                    break;
+
+                if (Clock::now() > due)
+                    lateStarts++;
+                else
+                    std::this_thread::sleep_until(due);
+
+                runOperation(pickKind(), due);
+            }
+
+            std::lock_guard<std::mutex> guard(resultsLock);
+            for (int kind = 0; kind < OP_KIND_COUNT; kind++)
+                results[kind].merge(tally[kind]);
+        }
+
+    private:
+        int index;
+        Clock::time_point start;
+        std::mt19937 random;
+        sockaddr_in source;
+        bool hasSource = false;
+        Tally tally[OP_KIND_COUNT];
+
+        static Clock::duration toDuration(double seconds)
+        {
+            return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+        }
+
+        OperationKind pickKind()
+        {
+            int total = options.weights[OP_MOTION] + options.weights[OP_SERVO] + options.weights[OP_STATUS];
+            int roll = (int)(random() % (unsigned)std::max(1, total));
+            for (int kind = 0; kind < OP_KIND_COUNT; kind++)
+            {
+                if (roll < options.weights[kind])
+                    return (OperationKind)kind;
+                roll -= options.weights[kind];
+            }
+            return OP_STATUS;
+        }
+
+        // The first request of an operation is timed from its due time, the
+        // rest from when the previous one finished.
+        void runOperation(OperationKind kind, Clock::time_point due)
+        {
+            char path[96];
+            switch (kind)
+            {
+            case OP_MOTION:
+            {
+                const char *action = MOTION_ACTIONS[random() % (sizeof(MOTION_ACTIONS) / sizeof(MOTION_ACTIONS[0]))];
+                for (int i = 0; i < options.burst; i++)
+                {
+                    snprintf(path, sizeof(path), "/cmd?target=motion&action=%s&speed=185", action);
+                    due = request(kind, path, due);
+                }
+                due = request(kind, "/cmd?target=motion&action=stop", due);
+                break;
+            }
+            case OP_SERVO:
+            {
+                const char *const *sweep = SERVO_SWEEPS[random() % (sizeof(SERVO_SWEEPS) / sizeof(SERVO_SWEEPS[0]))];
+                for (int step = 1; step < 4; step++)
+                {
+                    snprintf(path, sizeof(path), "/cmd?target=%s&action=%s", sweep[0], sweep[step]);
+                    due = request(kind, path, due);
+                }
+                break;
+            }
+            case OP_STATUS:
+            default:
+                request(kind, "/status", due);
+                break;
+            }
+        }
+
+        Clock::time_point request(OperationKind kind, const char *path, Clock::time_point due)
+        {
+            char body[64];
+            int code = HostHttp::get(robotAddress, hasSource ? &source : nullptr, path, options.timeoutUs, body, sizeof(body));
+            Clock::time_point done = Clock::now();
+
+            Tally &t = tally[kind];
+            t.sent++;
+            if (code == 200)
+                t.ok++;
+            else if (code == 202)
+                t.coalesced++;
+            else if (code == 403)
+                t.readOnly++;
+            else
+                t.errors++;
+
+            t.latencyMs.push_back(std::chrono::duration<double, std::milli>(done - due).count());
+            return done;
+        }
+    };
+
+    double percentile(std::vector<double> &sorted, double p)
+    {
+        if (sorted.empty())
+            return 0.0;
+        size_t rank = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+    void printRow(const char *name, Tally &t)
+    {
+        std::sort(t.latencyMs.begin(), t.latencyMs.end());
+        printf("%-8s %7llu %7llu %9llu %9llu %7llu %8.2f %8.2f %8.2f %8.2f\n", name, (unsigned long long)t.sent,
+               (unsigned long long)t.ok, (unsigned long long)t.coalesced, (unsigned long long)t.readOnly,
+               (unsigned long long)t.errors, percentile(t.latencyMs, 50), percentile(t.latencyMs, 95),
+               percentile(t.latencyMs, 99), t.latencyMs.empty() ? 0.0 : t.latencyMs.back());
+    }
+
+    bool parseMix(const char *spec)
+    {
+        int parsed[OP_KIND_COUNT] = {};
+        std::string text = spec;
+        size_t pos = 0;
+        while (pos < text.size())
+        {
+            size_t comma = text.find(',', pos);
+            std::string field = text.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+            size_t equals = field.find('=');
+            if (equals == std::string::npos)
+                return false;
+
+            std::string name = field.substr(0, equals);
+            int weight = atoi(field.c_str() + equals + 1);
+            int kind = 0;
+            while (kind < OP_KIND_COUNT && name != KIND_NAMES[kind])
+                kind++;
+            if (kind == OP_KIND_COUNT || weight < 0)
+                return false;
+            parsed[kind] = weight;
+
+            if (comma == std::string::npos)
+                break;
+            pos = comma + 1;
+        }
+
+        if (parsed[OP_MOTION] + parsed[OP_SERVO] + parsed[OP_STATUS] == 0)
+            return false;
+        memcpy(options.weights, parsed, sizeof(parsed));
+        return true;
+    }
+
+    bool parseArgs(int argc, char **argv)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            if (flag == "--robot")
+                options.robot = argv[i + 1];
+            else if (flag == "--clients")
+                options.clients = std::max(1, atoi(argv[i + 1]));
+            else if (flag == "--rate")
+                options.rate = atof(argv[i + 1]);
+            else if (flag == "--duration-s")
+                options.durationS = atof(argv[i + 1]);
+            else if (flag == "--mix" && !parseMix(argv[i + 1]))
+                return false;
+            else if (flag == "--burst")
+                options.burst = std::max(1, atoi(argv[i + 1]));
+            else if (flag == "--source-base")
+                options.sourceBase = argv[i + 1];
+            else if (flag == "--timeout-ms")
+                options.timeoutUs = (int64_t)(atof(argv[i + 1]) * 1000);
+            else if (flag == "--seed")
+                options.seed = (unsigned)atoi(argv[i + 1]);
+            else if (flag == "--max-error-pct")
+                options.maxErrorPct = atof(argv[i + 1]);
+        }
+        return options.rate > 0 && options.durationS > 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (!parseArgs(argc, argv) || !HostUdp::parseAddress(options.robot.c_str(), robotAddress))
+    {
+        fprintf(stderr, "usage: %s [--robot ip:port] [--clients N] [--rate OPS_PER_S] [--duration-s S] "
+                        "[--mix motion=W,servo=W,status=W] [--burst N] [--source-base IP] [--timeout-ms MS] "
+                        "[--seed N] [--max-error-pct PCT]\n",
+                argv[0]);
+        return 2;
+    }
+
+    printf("robot=%s clients=%d rate=%.2f ops/s/client duration=%.1f s mix=motion:%d,servo:%d,status:%d burst=%d\n",
+           options.robot.c_str(), options.clients, options.rate, options.durationS, options.weights[OP_MOTION],
+           options.weights[OP_SERVO], options.weights[OP_STATUS], options.burst);
+    fflush(stdout);
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < options.clients; i++)
+        threads.emplace_back([i, start]() { Client(i, start).run(); });
+    for (std::thread &thread : threads)
+        thread.join();
+    double elapsedS = std::chrono::duration<double>(Clock::now() - start).count();
+
+    printf("\n%-8s %7s %7s %9s %9s %7s %8s %8s %8s %8s\n", "kind", "sent", "ok", "coalesced", "read_only", "errors",
+           "p50_ms", "p95_ms", "p99_ms", "max_ms");
+
+    Tally total;
+    for (int kind = 0; kind < OP_KIND_COUNT; kind++)
+    {
+        total.merge(results[kind]);
+        printRow(KIND_NAMES[kind], results[kind]);
+    }
+    printRow("total", total);
+
+    double errorPct = total.sent > 0 ? 100.0 * total.errors / total.sent : 0.0;
+    printf("\nthroughput=%.1f req/s error_rate=%.2f%% late_starts=%llu max_error_pct=%.2f\n", total.sent / elapsedS,
+           errorPct, (unsigned long long)lateStarts.load(), options.maxErrorPct);
+
+    return errorPct <= options.maxErrorPct ? 0 : 1;
+}
@@ -0,0 +1,575 @@
+/**
+ * Differential-Drive Simulator — robot_main_v2 on the host
+ *
+ * Runs the real autonomous_drive / motor_control / range_sensor /
+ * servo_ioc_module code much faster than real time. The L298N pins and LEDC
+ * duties written by the firmware are decoded into wheel commands; PCA9685
+ * writes go through the sim_pca9685 stand-in.
+ *
+ * Plant model (1 ms steps, firmware ticks every ACTIVE_TICK_MS):
+ *   • wheels: L298N voltage drop, static-friction deadband, first-order lag
+ *   • battery: open-circuit voltage over state of charge, internal resistance
+ *              sag under motor + servo current, coulomb counting
+ *   • servos: slew-rate limited towards the commanded pulse, limp when the
+ *             channel is released (full-off)
+ *   • world: rectangular arena; the HC-SR04 sees the nearest wall ahead
+ *
+ * Usage:
+ *   drive_sim [--duration S] [--seed N] [--auto-pose] [--sample-ms MS]
+ *             [--trajectory out.csv] [--set name=value ...]
+ *             [--sweep name=start:stop:step]
+ *
+ * Names accepted by --set/--sweep are listed by --list-params. Drive tuning
+ * (forward_speed, turn_ms, ...) goes through setAutonomousDriveTuning(), so
+ * sweeps need no rebuild.
+ */
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <map>
+#include <math.h>
+#include <string>
+
+#include "autonomous_drive.h"
+#include "host_hw.h"
+#include "motor_control.h"
+#include "range_sensor.h"
+#include "robot_constants.h"
+#include "servo_ioc_module.h"
+#include "sim_echo_feed.h"
+#include "sim_pca9685.h"
+
+namespace
+{
+    constexpr uint64_t STEP_US = 1000;
+    constexpr uint64_t TICK_US = RobotConst::ACTIVE_TICK_MS * 1000ULL;
+    constexpr uint64_t START_US = 1000000;
+    constexpr double STEP_S = STEP_US / 1e6;
+    constexpr double RAD_TO_DEG = 180.0 / M_PI;
+
+    struct ServoSim
+    {
+        uint8_t servoId;
+        const char *name;
+        double angleDeg;
+    };
+
+    struct Plant
+    {
+        double x;
+        double y;
+        double theta;
+        double vLeft;
+        double vRight;
+        double batteryV;
+        double soc;
+        double currentA;
+        double usedMah;
+        double distanceM;
+        double minBatteryV;
+        uint32_t collisions;
+        bool touchingWall;
+    };
+
+    struct RunSummary
+    {
+        double simSeconds;
+        double wallSeconds;
+        Plant plant;
+        uint32_t avoidTurns;
+    };
+
+    // Plant parameters, addressable by name for --set and --sweep.
+    struct Model
+    {
+        double trackM = 0.14;
+        double robotRadiusM = 0.10;
+        double maxWheelSpeedMps = 0.60;
+        double motorTauS = 0.12;
+        double deadbandDuty = 0.22;
+        double l298nDropV = 1.8;
+        double motorROhm = 5.0;
+        double motorNoLoadA = 0.15;
+        double batteryVocFullV = 8.4;
+        double batteryVocEmptyV = 6.4;
+        double batteryROhm = 0.25;
+        double batteryMah = 2000.0;
+        double batterySoc = 1.0;
+        double servoSlewDps = 400.0;
+        double servoMovingA = 0.25;
+        double servoHoldA = 0.05;
+        double arenaWM = 3.0;
+        double arenaHM = 2.0;
+        double startXM = 1.5;
+        double startYM = 1.0;
+        double startHeadingDeg = 0.0;
+        double rangeNoiseMm = 5.0;
+        double rangeSpikeRate = 0.01;
+    };
+
+    Model model;
+
+    const std::map<std::string, double *> params = {
+        {"track_m", &model.trackM},
+        {"robot_radius_m", &model.robotRadiusM},
+        {"max_wheel_speed_mps", &model.maxWheelSpeedMps},
+        {"motor_tau_s", &model.motorTauS},
+        {"deadband_duty", &model.deadbandDuty},
+        {"l298n_drop_v", &model.l298nDropV},
+        {"motor_r_ohm", &model.motorROhm},
+        {"motor_no_load_a", &model.motorNoLoadA},
+        {"battery_voc_full_v", &model.batteryVocFullV},
+        {"battery_voc_empty_v", &model.batteryVocEmptyV},
+        {"battery_r_ohm", &model.batteryROhm},
+        {"battery_mah", &model.batteryMah},
+        {"battery_soc", &model.batterySoc},
+        {"servo_slew_dps", &model.servoSlewDps},
+        {"servo_moving_a", &model.servoMovingA},
+        {"servo_hold_a", &model.servoHoldA},
+        {"arena_w_m", &model.arenaWM},
+        {"arena_h_m", &model.arenaHM},
+        {"start_x_m", &model.startXM},
+        {"start_y_m", &model.startYM},
+        {"start_heading_deg", &model.startHeadingDeg},
+        {"range_noise_mm", &model.rangeNoiseMm},
+        {"range_spike_rate", &model.rangeSpikeRate},
+    };
+
+    const char *const TUNING_PARAMS[] = {
+        "forward_speed", "turn_speed", "forward1_ms", "turn_right_ms", "forward2_ms", "turn_left_ms", "stop_ms"};
+
+    std::map<std::string, double> tuningOverrides;
+
+    ServoSim servos[] = {
+        {RobotConst::HEAD_SERVO_ID, "head", 0.0},
+        {RobotConst::LEFT_ARM_SERVO_ID, "left_arm", 0.0},
+        {RobotConst::RIGHT_ARM_SERVO_ID, "right_arm", 0.0},
+    };
+
+    Plant plant;
+
+    uint16_t servoOffCount(uint8_t servoId)
+    {
+        uint8_t channel = servoId - 1;
+        return SimPca9685::offCount(RobotConst::PCA9685_ADDRESSES[channel / RobotConst::SERVO_CONTROLLER_CHANNELS],
+                                    channel % RobotConst::SERVO_CONTROLLER_CHANNELS);
+    }
+
+    // Horn angle in the same logical degrees /status reports.
+    double pulseToAngle(uint8_t servoId, uint16_t off)
+    {
+        RobotConst::ServoCalibration calibration = {servoId, RobotConst::SERVOMIN, RobotConst::SERVOMAX, false};
+        for (const RobotConst::ServoCalibration &entry : RobotConst::SERVO_CALIBRATION)
+        {
+            if (entry.servoId == servoId)
+                calibration = entry;
+        }
+
+        double physical = (off - calibration.minPulse) * 180.0 / (calibration.maxPulse - calibration.minPulse);
+        return calibration.inverted ? 180.0 - physical : physical;
+    }
+
+    bool isTuningParam(const std::string &name)
+    {
+        for (const char *tuningName : TUNING_PARAMS)
+        {
+            if (name == tuningName)
+                return true;
+        }
+        return false;
+    }
+
+    DriveTuning buildTuning()
+    {
+        DriveTuning tuning = getDefaultDriveTuning();
+        for (const auto &entry : tuningOverrides)
+        {
+            long value = lround(entry.second);
+            if (entry.first == "forward_speed")
+                tuning.forwardSpeed = (uint8_t)constrain(value, 0L, 255L);
+            else if (entry.first == "turn_speed")
+                tuning.turnSpeed = (uint8_t)constrain(value, 0L, 255L);
+            else if (entry.first == "forward1_ms")
+                tuning.forward1Ms = value;
+            else if (entry.first == "turn_right_ms")
+                tuning.turnRightMs = value;
+            else if (entry.first == "forward2_ms")
+                tuning.forward2Ms = value;
+            else if (entry.first == "turn_left_ms")
+                tuning.turnLeftMs = value;
+            else if (entry.first == "stop_ms")
+                tuning.stopMs = value;
+        }
+        return tuning;
+    }
+
+    bool setParam(const std::string &name, double value)
+    {
+        if (isTuningParam(name))
+        {
+            tuningOverrides[name] = value;
+            return true;
+        }
+
+        auto it = params.find(name);
+        if (it == params.end())
+            return false;
+
+        *it->second = value;
+        return true;
+    }
+
+    // Signed command in -1..1 decoded from the L298N direction pins and duty.
+    double decodeWheelCommand(uint8_t in1, uint8_t in2, uint8_t enable, bool inverted)
+    {
+        int a = HostHw::outputLevel(in1);
+        int b = HostHw::outputLevel(in2);
+        if (a == b)
+            return 0.0;
+
+        double sign = (a == HIGH) ? 1.0 : -1.0;
+        if (inverted)
+            sign = -sign;
+
+        return sign * HostHw::pwmDuty(enable) / 255.0;
+    }
+
+    double batteryOpenCircuitV()
+    {
+        return model.batteryVocEmptyV + (model.batteryVocFullV - model.batteryVocEmptyV) * plant.soc;
+    }
+
+    double stepWheel(double command, double &speed)
+    {
+        double maxSpeed = model.maxWheelSpeedMps;
+        double drop = model.l298nDropV;
+        double kv = maxSpeed / (model.batteryVocFullV - drop);
+
+        double applied = 0.0;
+        if (fabs(command) >= model.deadbandDuty)
+            applied = std::max(0.0, fabs(command) * plant.batteryV - drop);
+
+        double target = (command >= 0.0 ? 1.0 : -1.0) * applied * kv;
+        speed += (target - speed) * STEP_S / model.motorTauS;
+
+        if (applied <= 0.0)
+            return 0.0;
+
+        double backEmf = fabs(speed) / kv;
+        return std::max(0.0, applied - backEmf) / model.motorROhm + model.motorNoLoadA;
+    }
+
+    double stepServos()
+    {
+        double current = 0.0;
+        double maxStep = model.servoSlewDps * STEP_S;
+
+        for (ServoSim &servo : servos)
+        {
+            uint16_t off = servoOffCount(servo.servoId);
+            if (off == 0 || off == SimPca9685::FULL_OFF)
+                continue;
+
+            double target = pulseToAngle(servo.servoId, off);
+            double delta = constrain(target - servo.angleDeg, -maxStep, maxStep);
+            servo.angleDeg += delta;
+            current += fabs(delta) > 1e-9 ? model.servoMovingA : model.servoHoldA;
+        }
+
+        return current;
+    }
+
+    double rangeToWallMm()
+    {
+        double radius = model.robotRadiusM;
+        double sx = plant.x + radius * cos(plant.theta);
+        double sy = plant.y + radius * sin(plant.theta);
+        double dx = cos(plant.theta);
+        double dy = sin(plant.theta);
+
+        double best = 1e9;
+        if (dx > 1e-9)
+            best = std::min(best, (model.arenaWM - sx) / dx);
+        if (dx < -1e-9)
+            best = std::min(best, -sx / dx);
+        if (dy > 1e-9)
+            best = std::min(best, (model.arenaHM - sy) / dy);
+        if (dy < -1e-9)
+            best = std::min(best, -sy / dy);
+
+        return std::max(0.0, best) * 1000.0;
+    }
+
+    void keepInsideArena()
+    {
+        double radius = model.robotRadiusM;
+        double clampedX = constrain(plant.x, radius, model.arenaWM - radius);
+        double clampedY = constrain(plant.y, radius, model.arenaHM - radius);
+        bool touching = clampedX != plant.x || clampedY != plant.y;
+
+        if (touching && !plant.touchingWall)
+            plant.collisions++;
+
+        plant.touchingWall = touching;
+        plant.x = clampedX;
+        plant.y = clampedY;
+    }
+
+    void stepPlant()
+    {
+        double left = decodeWheelCommand(RobotPins::IN1_PIN, RobotPins::IN2_PIN, RobotPins::ENA_PIN, RobotConst::MOTOR_A_INVERTED);
+        double right = decodeWheelCommand(RobotPins::IN3_PIN, RobotPins::IN4_PIN, RobotPins::ENB_PIN, RobotConst::MOTOR_B_INVERTED);
+
+        plant.batteryV = batteryOpenCircuitV() - model.batteryROhm * plant.currentA;
+        plant.minBatteryV = std::min(plant.minBatteryV, plant.batteryV);
+
+        double current = stepWheel(left, plant.vLeft) + stepWheel(right, plant.vRight) + stepServos();
+        plant.currentA = current;
+
+        double drawnMah = current * 1000.0 * STEP_S / 3600.0;
+        plant.usedMah += drawnMah;
+        plant.soc = std::max(0.0, plant.soc - drawnMah / model.batteryMah);
+
+        double v = (plant.vLeft + plant.vRight) / 2.0;
+        double w = (plant.vRight - plant.vLeft) / model.trackM;
+        plant.x += v * cos(plant.theta) * STEP_S;
+        plant.y += v * sin(plant.theta) * STEP_S;
+        plant.theta = remainder(plant.theta + w * STEP_S, 2.0 * M_PI);
+        plant.distanceM += fabs(v) * STEP_S;
+
+        keepInsideArena();
+    }
+
+    void resetRun(unsigned seed, bool autoPose)
+    {
+        HostHw::setNowUs(START_US);
+        HostHw::resetCounters();
+        SimPca9685::reset();
+
+        plant = Plant();
+        plant.x = model.startXM;
+        plant.y = model.startYM;
+        plant.theta = model.startHeadingDeg / RAD_TO_DEG;
+        plant.soc = model.batterySoc;
+        plant.batteryV = batteryOpenCircuitV();
+        plant.minBatteryV = plant.batteryV;
+
+        SimEchoFeed::begin(rangeToWallMm, seed, model.rangeNoiseMm, model.rangeSpikeRate);
+
+        initMotors();
+        initRangeSensor();
+        initServoIOC();
+        initAutonomousDrive();
+
+        for (ServoSim &servo : servos)
+        {
+            servo.angleDeg = pulseToAngle(servo.servoId, servoOffCount(servo.servoId));
+        }
+
+        setAutonomousDriveTuning(buildTuning());
+        setAutonomousDriveEnabled(true);
+        setServoAutoPoseEnabled(autoPose);
+    }
+
+    void writeTrajectoryHeader(FILE *out)
+    {
+        fprintf(out, "t_s,x_m,y_m,heading_deg,v_left_mps,v_right_mps,battery_v,soc_pct,current_a,range_mm");
+        for (const ServoSim &servo : servos)
+            fprintf(out, ",%s_deg", servo.name);
+        fprintf(out, "\n");
+    }
+
+    void writeTrajectoryRow(FILE *out)
+    {
+        double t = (HostHw::nowUs() - START_US) / 1e6;
+        fprintf(out, "%.3f,%.4f,%.4f,%.1f,%.3f,%.3f,%.3f,%.2f,%.3f,%u",
+                t, plant.x, plant.y, plant.theta * RAD_TO_DEG, plant.vLeft, plant.vRight,
+                plant.batteryV, plant.soc * 100.0, plant.currentA, getRangeDistanceMm());
+        for (const ServoSim &servo : servos)
+            fprintf(out, ",%.1f", servo.angleDeg);
+        fprintf(out, "\n");
+    }
+
+    RunSummary runSimulation(double durationS, unsigned seed, bool autoPose, unsigned sampleMs, FILE *trajectory)
+    {
+        auto wallStart = std::chrono::steady_clock::now();
+        resetRun(seed, autoPose);
+        uint32_t avoidsBefore = getObstacleAvoidCount();
+
+        uint64_t endUs = START_US + (uint64_t)(durationS * 1e6);
+        uint64_t nextTickUs = START_US;
+        uint64_t nextSampleUs = START_US;
+        uint64_t sampleUs = (uint64_t)sampleMs * 1000;
+
+        if (trajectory != nullptr)
+            writeTrajectoryHeader(trajectory);
+
+        while (HostHw::nowUs() < endUs)
+        {
+            if (HostHw::nowUs() >= nextTickUs)
+            {
+                updateRangeSensor();
+                updateAutonomousDrive();
+                updateServoIOC();
+                nextTickUs += TICK_US;
+            }
+
+            if (trajectory != nullptr && HostHw::nowUs() >= nextSampleUs)
+            {
+                writeTrajectoryRow(trajectory);
+                nextSampleUs += sampleUs;
+            }
+
+            stepPlant();
+            SimEchoFeed::runUntil(HostHw::nowUs() + STEP_US);
+        }
+
+        RunSummary summary;
+        summary.simSeconds = durationS;
+        summary.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+        summary.plant = plant;
+        summary.avoidTurns = getObstacleAvoidCount() - avoidsBefore;
+        return summary;
+    }
+
+    void printSummaryHeader(const char *sweepName)
+    {
+        if (sweepName != nullptr)
+            printf("%s,", sweepName);
+        printf("distance_m,final_x_m,final_y_m,final_heading_deg,collisions,avoid_turns,min_battery_v,used_mah,sim_s,realtime_factor\n");
+    }
+
+    void printSummaryRow(const RunSummary &summary, const char *sweepName, double sweepValue)
+    {
+        if (sweepName != nullptr)
+            printf("%g,", sweepValue);
+        printf("%.3f,%.3f,%.3f,%.1f,%u,%u,%.3f,%.2f,%.0f,%.0f\n",
+               summary.plant.distanceM, summary.plant.x, summary.plant.y, summary.plant.theta * RAD_TO_DEG,
+               summary.plant.collisions, summary.avoidTurns, summary.plant.minBatteryV, summary.plant.usedMah,
+               summary.simSeconds, summary.simSeconds / std::max(summary.wallSeconds, 1e-9));
+    }
+
+    bool parseAssignment(const char *text, std::string &name, std::string &value)
+    {
+        const char *equals = strchr(text, '=');
+        if (equals == nullptr)
+            return false;
+
+        name.assign(text, equals - text);
+        value.assign(equals + 1);
+        return true;
+    }
+
+    void listParams()
+    {
+        DriveTuning tuning = getDefaultDriveTuning();
+        printf("drive tuning (defaults from robot_constants.h):\n");
+        printf("  forward_speed=%u turn_speed=%u forward1_ms=%lu turn_right_ms=%lu forward2_ms=%lu turn_left_ms=%lu stop_ms=%lu\n",
+               tuning.forwardSpeed, tuning.turnSpeed, tuning.forward1Ms, tuning.turnRightMs,
+               tuning.forward2Ms, tuning.turnLeftMs, tuning.stopMs);
+        printf("plant model:\n");
+        for (const auto &entry : params)
+            printf("  %s=%g\n", entry.first.c_str(), *entry.second);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    double durationS = 600.0;
+    unsigned seed = 1;
+    bool autoPose = false;
+    unsigned sampleMs = 50;
+    const char *trajectoryPath = nullptr;
+    std::string sweepName;
+    double sweepStart = 0.0;
+    double sweepStop = 0.0;
+    double sweepStep = 1.0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string flag = argv[i];
+        bool hasValue = i + 1 < argc;
+        std::string name;
+        std::string value;
+
+        if (flag == "--list-params")
+        {
+            listParams();
+            return 0;
+        }
+        if (flag == "--auto-pose")
+            autoPose = true;
+        else if (flag == "--duration" && hasValue)
+            durationS = atof(argv[++i]);
+        else if (flag == "--seed" && hasValue)
+            seed = (unsigned)atoi(argv[++i]);
+        else if (flag == "--sample-ms" && hasValue)
+            sampleMs = std::max(1, atoi(argv[++i]));
+        else if (flag == "--trajectory" && hasValue)
+            trajectoryPath = argv[++i];
+        else if (flag == "--set" && hasValue && parseAssignment(argv[++i], name, value))
+        {
+            if (!setParam(name, atof(value.c_str())))
+            {
+                fprintf(stderr, "unknown parameter: %s (see --list-params)\n", name.c_str());
+                return 2;
+            }
+        }
+        else if (flag == "--sweep" && hasValue && parseAssignment(argv[++i], name, value) &&
+                 sscanf(value.c_str(), "%lf:%lf:%lf", &sweepStart, &sweepStop, &sweepStep) == 3 && sweepStep > 0)
+        {
+            sweepName = name;
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--duration S] [--seed N] [--auto-pose] [--sample-ms MS] "
+                            "[--trajectory out.csv] [--set name=value] [--sweep name=start:stop:step] [--list-params]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    FILE *trajectory = nullptr;
+    if (trajectoryPath != nullptr)
+    {
+        trajectory = fopen(trajectoryPath, "w");
+        if (trajectory == nullptr)
+        {
+            perror(trajectoryPath);
+            return 1;
+        }
+    }
+
+    if (sweepName.empty())
+    {
+        printSummaryHeader(nullptr);
+        printSummaryRow(runSimulation(durationS, seed, autoPose, sampleMs, trajectory), nullptr, 0.0);
+    }
+    else
+    {
+        if (!setParam(sweepName, sweepStart))
+        {
+            fprintf(stderr, "unknown parameter: %s (see --list-params)\n", sweepName.c_str());
+            return 2;
+        }
+
+        // Only the first sweep point is traced, to keep the file one run long.
+        printSummaryHeader(sweepName.c_str());
+        for (double value = sweepStart; value <= sweepStop + 1e-9; value += sweepStep)
+        {
+            setParam(sweepName, value);
+            printSummaryRow(runSimulation(durationS, seed, autoPose, sampleMs, trajectory), sweepName.c_str(), value);
+            if (trajectory != nullptr)
+            {
+                fclose(trajectory);
+                trajectory = nullptr;
+            }
+        }
+    }
+
+    if (trajectory != nullptr)
+        fclose(trajectory);
+
+    return 0;
+}
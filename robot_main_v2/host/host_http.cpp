@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "host_http.h"
+
+namespace
+{
+    constexpr size_t REQUEST_CAPACITY = 1024;
+
+    int64_t monotonicUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    bool waitFor(int fd, short events, int64_t deadlineUs)
+    {
+        int64_t remainingUs = deadlineUs - monotonicUs();
+        if (remainingUs <= 0)
+            return false;
+
+        pollfd waitFd = {fd, events, 0};
+        return poll(&waitFd, 1, (int)((remainingUs + 999) / 1000)) > 0;
+    }
+
+    bool sendAll(int fd, const char *data, size_t len)
+    {
+        while (len > 0)
+        {
+            ssize_t sent = send(fd, data, len, MSG_NOSIGNAL);
+            if (sent <= 0)
+                return false;
+            data += sent;
+            len -= (size_t)sent;
+        }
+        return true;
+    }
+
+    int hexValue(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    }
+
+    // Returns false if the decoded value had to be cut short.
+    bool decodeInto(const char *src, size_t srcLen, char *dest, size_t destSize)
+    {
+        size_t out = 0;
+        size_t i = 0;
+        for (; i < srcLen && out + 1 < destSize; i++)
+        {
+            if (src[i] == '+')
+                dest[out++] = ' ';
+            else if (src[i] == '%' && i + 2 < srcLen && hexValue(src[i + 1]) >= 0 && hexValue(src[i + 2]) >= 0)
+            {
+                dest[out++] = (char)(hexValue(src[i + 1]) * 16 + hexValue(src[i + 2]));
+                i += 2;
+            }
+            else
+                dest[out++] = src[i];
+        }
+        dest[out] = '\0';
+        return i == srcLen;
+    }
+
+    const char *reasonPhrase(int code)
+    {
+        switch (code)
+        {
+        case 200:
+            return "OK";
+        case 202:
+            return "Accepted";
+        case 400:
+            return "Bad Request";
+        case 403:
+            return "Forbidden";
+        case 404:
+            return "Not Found";
+        case 503:
+            return "Service Unavailable";
+        default:
+            return "Internal Server Error";
+        }
+    }
+}
+
+namespace HostHttp
+{
+    int listen(uint16_t port)
+    {
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+
+        int reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+        if (bind(fd, (const sockaddr *)&address, sizeof(address)) != 0 || ::listen(fd, 16) != 0)
+        {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    int acceptRequest(int listenFd, Request &request, int64_t timeoutUs)
+    {
+        sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int fd = accept(listenFd, (sockaddr *)&from, &fromLen);
+        if (fd < 0)
+            return -1;
+
+        char raw[REQUEST_CAPACITY];
+        size_t len = 0;
+        int64_t deadlineUs = monotonicUs() + timeoutUs;
+        while (len + 1 < sizeof(raw) && waitFor(fd, POLLIN, deadlineUs))
+        {
+            ssize_t got = recv(fd, raw + len, sizeof(raw) - 1 - len, 0);
+            if (got <= 0)
+                break;
+            len += (size_t)got;
+            raw[len] = '\0';
+            if (strstr(raw, "\r\n\r\n") != nullptr)
+                break;
+        }
+        raw[len] = '\0';
+
+        char target[sizeof(request.path) + sizeof(request.query)];
+        if (sscanf(raw, "GET %319s HTTP/1.%*c", target) != 1)
+        {
+            sendResponse(fd, 400, "text/plain", "BAD REQUEST");
+            ::close(fd);
+            return -1;
+        }
+
+        request.clientIp = from.sin_addr.s_addr;
+        char *question = strchr(target, '?');
+        if (question != nullptr)
+            *question = '\0';
+        snprintf(request.path, sizeof(request.path), "%.*s", (int)sizeof(request.path) - 1, target);
+        snprintf(request.query, sizeof(request.query), "%.*s", (int)sizeof(request.query) - 1,
+                 question != nullptr ? question + 1 : "");
+        return fd;
+    }
+
+    void sendResponse(int connectionFd, int code, const char *contentType, const char *body)
+    {
+        char header[160];
+        int headerLen = snprintf(header, sizeof(header),
+                                 "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                                 code, reasonPhrase(code), contentType, strlen(body));
+        if (sendAll(connectionFd, header, (size_t)headerLen))
+            sendAll(connectionFd, body, strlen(body));
+    }
+
+    bool getArg(const Request &request, const char *name, char *dest, size_t destSize)
+    {
+        size_t nameLen = strlen(name);
+        const char *field = request.query;
+        while (*field != '\0')
+        {
+            const char *end = strchr(field, '&');
+            size_t fieldLen = end != nullptr ? (size_t)(end - field) : strlen(field);
+
+            if (fieldLen >= nameLen && strncmp(field, name, nameLen) == 0 &&
+                (fieldLen == nameLen || field[nameLen] == '='))
+            {
+                const char *value = fieldLen > nameLen ? field + nameLen + 1 : field + nameLen;
+                return decodeInto(value, fieldLen - (size_t)(value - field), dest, destSize);
+            }
+
+            if (end == nullptr)
+                break;
+            field = end + 1;
+        }
+
+        if (destSize > 0)
+            dest[0] = '\0';
+        return false;
+    }
+
+    int get(const sockaddr_in &server, const sockaddr_in *source, const char *path, int64_t timeoutUs,
+            char *body, size_t bodySize)
+    {
+        int64_t deadlineUs = monotonicUs() + timeoutUs;
+        if (bodySize > 0)
+            body[0] = '\0';
+
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+            return -1;
+
+        if (source != nullptr && bind(fd, (const sockaddr *)source, sizeof(*source)) != 0)
+        {
+            ::close(fd);
+            return -1;
+        }
+
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        if (connect(fd, (const sockaddr *)&server, sizeof(server)) != 0 && errno != EINPROGRESS)
+        {
+            ::close(fd);
+            return -1;
+        }
+
+        int connectError = 0;
+        socklen_t errorLen = sizeof(connectError);
+        if (!waitFor(fd, POLLOUT, deadlineUs) ||
+            getsockopt(fd, SOL_SOCKET, SO_ERROR, &connectError, &errorLen) != 0 || connectError != 0)
+        {
+            ::close(fd);
+            return -1;
+        }
+
+        char request[512];
+        int requestLen = snprintf(request, sizeof(request),
+                                  "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", path,
+                                  inet_ntoa(server.sin_addr));
+        if (requestLen >= (int)sizeof(request) || !sendAll(fd, request, (size_t)requestLen))
+        {
+            ::close(fd);
+            return -1;
+        }
+
+        // Read the whole reply: the status line first, then as much body as fits.
+        char reply[2048];
+        size_t len = 0;
+        bool complete = false;
+        while (waitFor(fd, POLLIN, deadlineUs))
+        {
+            char chunk[1024];
+            ssize_t got = recv(fd, chunk, sizeof(chunk), 0);
+            if (got < 0 && (errno == EAGAIN || errno == EINTR))
+                continue;
+            if (got <= 0)
+            {
+                complete = got == 0;
+                break;
+            }
+            size_t keep = std::min((size_t)got, sizeof(reply) - 1 - len);
+            memcpy(reply + len, chunk, keep);
+            len += keep;
+        }
+        ::close(fd);
+        reply[len] = '\0';
+
+        int code = 0;
+        if (!complete || sscanf(reply, "HTTP/1.%*c %d", &code) != 1)
+            return -1;
+
+        const char *payload = strstr(reply, "\r\n\r\n");
+        if (payload != nullptr && bodySize > 0)
+            snprintf(body, bodySize, "%s", payload + 4);
+        return code;
+    }
+
+    void close(int fd)
+    {
+        if (fd >= 0)
+            ::close(fd);
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef HOST_HTTP_H
+#define HOST_HTTP_H
+
+#include <netinet/in.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Minimal blocking HTTP/1.1 over POSIX sockets for the host tools: one
+// request per connection, "Connection: close", like the robot's WebServer.
+
+namespace HostHttp
+{
+    struct Request
+    {
+        uint32_t clientIp; // network order, like lwIP
+        char path[64];
+        char query[256];
+    };
+
+    // ─── Server side ────────────────────────────────────────────────
+    // Listens on all interfaces. Returns the fd, or -1.
+    int listen(uint16_t port);
+
+    // Accepts one pending connection and reads its request line. Returns the
+    // connection fd, or -1 if nothing usable arrived.
+    int acceptRequest(int listenFd, Request &request, int64_t timeoutUs);
+
+    void sendResponse(int connectionFd, int code, const char *contentType, const char *body);
+
+    // Copies the URL-decoded query argument into dest; false if absent or
+    // cut short.
+    bool getArg(const Request &request, const char *name, char *dest, size_t destSize);
+
+    // ─── Client side ────────────────────────────────────────────────
+    // GETs path from server, optionally from a fixed source address (any
+    // 127.x.x.x works on loopback, so one host can act as many clients).
+    // Returns the HTTP status code, or -1 on a connect, send or read failure
+    // or timeout. The body is truncated to bodySize.
+    int get(const sockaddr_in &server, const sockaddr_in *source, const char *path, int64_t timeoutUs,
+            char *body, size_t bodySize);
+
+    void close(int fd);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include <arpa/inet.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "host_udp.h"
+
+namespace HostUdp
+{
+    int open(uint16_t port)
+    {
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd < 0)
+            return -1;
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+        if (bind(fd, (const sockaddr *)&address, sizeof(address)) != 0)
+        {
+            ::close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    void close(int fd)
+    {
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    bool parseAddress(const char *hostPort, sockaddr_in &address)
+    {
+        char host[64];
+        const char *colon = strrchr(hostPort, ':');
+        if (colon == nullptr || (size_t)(colon - hostPort) >= sizeof(host))
+            return false;
+
+        memcpy(host, hostPort, colon - hostPort);
+        host[colon - hostPort] = '\0';
+
+        address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons((uint16_t)atoi(colon + 1));
+        return inet_pton(AF_INET, host, &address.sin_addr) == 1;
+    }
+
+    bool sendTo(int fd, const sockaddr_in &address, const uint8_t *data, size_t len)
+    {
+        return sendto(fd, data, len, 0, (const sockaddr *)&address, sizeof(address)) == (ssize_t)len;
+    }
+
+    long receive(int fd, uint8_t *data, size_t capacity, sockaddr_in &from, int64_t timeoutUs)
+    {
+        pollfd waitFd = {fd, POLLIN, 0};
+        int timeoutMs = timeoutUs <= 0 ? 0 : (int)((timeoutUs + 999) / 1000);
+        if (poll(&waitFd, 1, timeoutMs) <= 0)
+            return -1;
+
+        socklen_t fromLen = sizeof(from);
+        return recvfrom(fd, data, capacity, 0, (sockaddr *)&from, &fromLen);
+    }
+
+    bool sameEndpoint(const sockaddr_in &a, const sockaddr_in &b)
+    {
+        return a.sin_addr.s_addr == b.sin_addr.s_addr && a.sin_port == b.sin_port;
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef HOST_UDP_H
+#define HOST_UDP_H
+
+#include <netinet/in.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Minimal blocking UDP socket for the host choreography tools.
+
+namespace HostUdp
+{
+    // Binds to port (0 = any) on all interfaces. Returns the fd, or -1.
+    int open(uint16_t port);
+    void close(int fd);
+
+    bool parseAddress(const char *hostPort, sockaddr_in &address);
+    bool sendTo(int fd, const sockaddr_in &address, const uint8_t *data, size_t len);
+
+    // Waits up to timeoutUs for one datagram; returns its length, or -1.
+    long receive(int fd, uint8_t *data, size_t capacity, sockaddr_in &from, int64_t timeoutUs);
+
+    bool sameEndpoint(const sockaddr_in &a, const sockaddr_in &b);
+}
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * Range Reaction Simulation — robot_main_v2 on the host
+ *
+ * Runs the real range_sensor / autonomous_drive / motor_control code against
+ * a synthetic HC-SR04. Every trigger pulse the firmware writes schedules echo
+ * edges that fire the echo ISR at the right microsecond, with Gaussian noise
+ * and random spike readings mixed in.
+ *
+ * Scenarios:
+ *   • pop-up  : an obstacle appears inside RANGE_STOP_MM at a random moment
+ *               while driving forward; reaction latency is the time until
+ *               the drive command stops being "both wheels forward".
+ *   • approach: drive at a wall and report how close the robot gets
+ *               before it turns away.
+ *
+ * Exits non-zero if the p99 reaction exceeds the analytical bound or any
+ * approach ends without an avoid turn. Back-to-back spike readings can push
+ * single trials past the bound; those are counted separately.
+ *
+ * Usage: range_sim [--trials N] [--seed S] [--noise-mm N] [--spike-rate P]
+ */
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "autonomous_drive.h"
+#include "host_hw.h"
+#include "motor_control.h"
+#include "range_sensor.h"
+#include "robot_constants.h"
+#include "sim_echo_feed.h"
+
+namespace
+{
+    constexpr uint64_t TICK_US = RobotConst::ACTIVE_TICK_MS * 1000ULL;
+    constexpr double MAX_SPEED_MM_PER_S = 600.0;
+    constexpr uint16_t FAR_MM = 3000;
+    constexpr uint64_t TRIAL_TIMEOUT_US = 1000000;
+
+    struct Options
+    {
+        int trials = 500;
+        unsigned seed = 1;
+        double noiseMm = 5.0;
+        double spikeRate = 0.02;
+    };
+
+    Options options;
+    std::mt19937 rng;
+    double obstacleMm = FAR_MM;
+
+    double trueObstacleMm()
+    {
+        return obstacleMm;
+    }
+
+    bool isMotorForward(uint8_t in1, uint8_t in2, uint8_t enable, bool inverted)
+    {
+        bool pinsForward = HostHw::outputLevel(in1) == HIGH && HostHw::outputLevel(in2) == LOW;
+        bool pinsBackward = HostHw::outputLevel(in1) == LOW && HostHw::outputLevel(in2) == HIGH;
+        bool forward = inverted ? pinsBackward : pinsForward;
+        return forward && HostHw::pwmDuty(enable) > 0;
+    }
+
+    bool isDrivingForward()
+    {
+        return isMotorForward(RobotPins::IN1_PIN, RobotPins::IN2_PIN, RobotPins::ENA_PIN, RobotConst::MOTOR_A_INVERTED) &&
+               isMotorForward(RobotPins::IN3_PIN, RobotPins::IN4_PIN, RobotPins::ENB_PIN, RobotConst::MOTOR_B_INVERTED);
+    }
+
+    // One pass of the firmware loop followed by one tick of world time.
+    void runTick()
+    {
+        updateRangeSensor();
+        updateAutonomousDrive();
+
+        uint64_t tickEndUs = HostHw::nowUs() + TICK_US;
+        if (isDrivingForward())
+        {
+            double speed = (HostHw::pwmDuty(RobotPins::ENA_PIN) + HostHw::pwmDuty(RobotPins::ENB_PIN)) / 2.0;
+            obstacleMm -= speed / 255.0 * MAX_SPEED_MM_PER_S * (TICK_US / 1e6);
+            obstacleMm = std::max(obstacleMm, 0.0);
+        }
+        SimEchoFeed::runUntil(tickEndUs);
+    }
+
+    void resetWorld(double startMm)
+    {
+        HostHw::setNowUs(1000000);
+        SimEchoFeed::reset();
+        obstacleMm = startMm;
+
+        initMotors();
+        initRangeSensor();
+        initAutonomousDrive();
+        setAutonomousDriveEnabled(true);
+    }
+
+    double percentile(std::vector<double> values, double p)
+    {
+        if (values.empty())
+            return 0.0;
+
+        std::sort(values.begin(), values.end());
+        size_t index = (size_t)std::min<double>(values.size() - 1, p / 100.0 * values.size());
+        return values[index];
+    }
+
+    double runPopUpTrial()
+    {
+        resetWorld(FAR_MM);
+
+        uint64_t warmupUs = std::uniform_int_distribution<uint64_t>(
+            200000, (RobotConst::DURATION_FORWARD_1 - 200) * 1000ULL)(rng);
+        uint64_t popAtUs = HostHw::nowUs() + warmupUs;
+        while (HostHw::nowUs() < popAtUs)
+            runTick();
+
+        obstacleMm = std::uniform_real_distribution<double>(120.0, RobotConst::RANGE_STOP_MM - 20.0)(rng);
+        uint64_t poppedUs = HostHw::nowUs();
+        while (isDrivingForward() && HostHw::nowUs() - poppedUs < TRIAL_TIMEOUT_US)
+            runTick();
+
+        return (HostHw::nowUs() - poppedUs) / 1000.0;
+    }
+
+    // Starts close enough that the wall is reached within DRIVE_FORWARD_1.
+    double runApproachTrial(bool &avoided)
+    {
+        resetWorld(800.0);
+
+        uint32_t avoidsBefore = getObstacleAvoidCount();
+        while (isDrivingForward())
+            runTick();
+
+        avoided = getObstacleAvoidCount() != avoidsBefore;
+        return obstacleMm;
+    }
+
+    void parseArgs(int argc, char **argv)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            if (flag == "--trials")
+                options.trials = atoi(argv[i + 1]);
+            else if (flag == "--seed")
+                options.seed = (unsigned)atoi(argv[i + 1]);
+            else if (flag == "--noise-mm")
+                options.noiseMm = atof(argv[i + 1]);
+            else if (flag == "--spike-rate")
+                options.spikeRate = atof(argv[i + 1]);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    parseArgs(argc, argv);
+    rng.seed(options.seed);
+    SimEchoFeed::begin(trueObstacleMm, options.seed + 1, options.noiseMm, options.spikeRate);
+
+    std::vector<double> latenciesMs;
+    std::vector<double> stopDistancesMm;
+    int avoidedCount = 0;
+    for (int i = 0; i < options.trials; i++)
+    {
+        bool avoided = false;
+        latenciesMs.push_back(runPopUpTrial());
+        stopDistancesMm.push_back(runApproachTrial(avoided));
+        avoidedCount += avoided ? 1 : 0;
+    }
+
+    // Median-of-3 needs two near pings after the pop, plus one more if a
+    // spike lands in the window; then the echo timeout and one loop tick.
+    double boundMs = 3.0 * RobotConst::RANGE_PING_INTERVAL_MS + RobotConst::RANGE_ECHO_TIMEOUT_MS + RobotConst::ACTIVE_TICK_MS;
+    double worstMs = percentile(latenciesMs, 100.0);
+    double p99Ms = percentile(latenciesMs, 99.0);
+    long overBound = std::count_if(latenciesMs.begin(), latenciesMs.end(), [&](double ms) { return ms > boundMs; });
+
+    printf("trials=%d seed=%u noise_mm=%.1f spike_rate=%.3f\n",
+           options.trials, options.seed, options.noiseMm, options.spikeRate);
+    printf("pop-up reaction ms: p50=%.1f p95=%.1f p99=%.1f max=%.1f bound=%.1f over_bound=%ld\n",
+           percentile(latenciesMs, 50), percentile(latenciesMs, 95), p99Ms, worstMs, boundMs, overBound);
+    printf("approach turn-away distance mm: min=%.0f p50=%.0f max=%.0f avoided=%d/%d (stop threshold %u)\n",
+           percentile(stopDistancesMm, 0), percentile(stopDistancesMm, 50), percentile(stopDistancesMm, 100),
+           avoidedCount, options.trials, RobotConst::RANGE_STOP_MM);
+
+    return (p99Ms <= boundMs && avoidedCount == options.trials) ? 0 : 1;
+}
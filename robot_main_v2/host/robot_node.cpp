@@ -0,0 +1,346 @@
+/**
+ * Robot Node — one robot on the host
+ *
+ * Runs the robot side of sync_protocol.cpp over a real UDP socket and applies
+ * due commands through the real robot_commands / motor_control /
+ * servo_ioc_module code. Start several on different ports to stand in for a
+ * group of robots on loopback.
+ *
+ * With --http-port it also serves /cmd, /batch and /status the way the
+ * firmware's handlers do: one request at a time, admitted through client_sessions.cpp
+ * (ownership, rate limit, coalescing), so cmd_load can be pointed at it.
+ *
+ * Each node has its own clock: an arbitrary offset plus a frequency error,
+ * like ESP32s booted at different times with different crystals. Pings are
+ * answered as soon as they arrive (the firmware answers them in the AsyncUDP
+ * callback); due commands are applied on a millisecond-granular loop like the
+ * firmware's deadline-driven tick.
+ *
+ * Usage: robot_node [--port N] [--http-port N] [--clock-offset-ms MS]
+ *                   [--drift-ppm PPM] [--exit-after-s S]
+ */
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <poll.h>
+#include <signal.h>
+
+#include "audio_engine.h"
+#include "autonomous_drive.h"
+#include "client_sessions.h"
+#include "host_http.h"
+#include "host_hw.h"
+#include "host_udp.h"
+#include "i2c_queue.h"
+#include "motor_control.h"
+#include "response_writer.h"
+#include "robot_commands.h"
+#include "robot_constants.h"
+#include "servo_ioc_module.h"
+#include "sim_audio.h"
+#include "sim_pca9685.h"
+#include "sync_protocol.h"
+
+namespace
+{
+    struct Options
+    {
+        uint16_t port = RobotConst::SYNC_UDP_PORT;
+        uint16_t httpPort = 0;
+        double clockOffsetMs = 0.0;
+        double driftPpm = 0.0;
+        double exitAfterS = 0.0;
+    };
+
+    constexpr int DEFAULT_WEB_SPEED = 185;
+    constexpr int64_t HTTP_READ_TIMEOUT_US = 200000;
+
+    Options options;
+    std::chrono::steady_clock::time_point startTime;
+    volatile sig_atomic_t running = 1;
+    const char *lastCommand = "none";
+    char statusBuffer[1536];
+
+    uint64_t robotClockUs()
+    {
+        double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+        return (uint64_t)(options.clockOffsetMs * 1000.0 + elapsedUs * (1.0 + options.driftPpm * 1e-6));
+    }
+
+    void onSignal(int)
+    {
+        running = 0;
+    }
+
+    // Same wait the firmware computes: whole milliseconds to the next
+    // command, capped at the active tick.
+    int64_t waitBudgetUs(uint64_t nowUs)
+    {
+        int64_t waitMs = RobotConst::ACTIVE_TICK_MS;
+        uint64_t nextUs = SyncProtocol::getNextCommandUs();
+        if (nextUs != UINT64_MAX)
+            waitMs = std::min<int64_t>(waitMs, nextUs > nowUs ? (int64_t)((nextUs - nowUs) / 1000) : 0);
+
+        return std::max<int64_t>(waitMs, 1) * 1000;
+    }
+
+    void applyDueCommands()
+    {
+        SyncProtocol::ScheduledCommand due;
+        while (SyncProtocol::takeDueCommand(robotClockUs(), due))
+        {
+            HostHw::setNowUs(robotClockUs());
+            if (getControllingClientIp() != 0)
+            {
+                printf("[node :%u] seq=%u blocked: web client holds control\n", options.port, due.seq);
+                continue;
+            }
+
+            const char *command = mapAndApplyCommand(due.target, due.action, due.speed);
+            uint64_t lateUs = robotClockUs() - due.atUs;
+            printf("[node :%u] seq=%u %s late_us=%llu\n", options.port, due.seq, command, (unsigned long long)lateUs);
+            fflush(stdout);
+        }
+    }
+
+    // Mirrors handleCommand() in robot_main_v2.ino.
+    void handleCommand(int fd, const HostHttp::Request &request)
+    {
+        char target[sizeof(SessionCommand::target)];
+        char action[sizeof(SessionCommand::action)];
+        char speedArg[8];
+        bool argsFit = HostHttp::getArg(request, "target", target, sizeof(target));
+        argsFit = HostHttp::getArg(request, "action", action, sizeof(action)) && argsFit;
+        int speed = HostHttp::getArg(request, "speed", speedArg, sizeof(speedArg)) ? atoi(speedArg) : DEFAULT_WEB_SPEED;
+
+        if (!argsFit)
+        {
+            noteClientRequest(request.clientIp);
+            HostHttp::sendResponse(fd, 400, "text/plain", "UNKNOWN");
+            return;
+        }
+
+        if (strcmp(target, "system") == 0 && strcmp(action, "release_control") == 0)
+        {
+            noteClientRequest(request.clientIp);
+            releaseClientControl(request.clientIp);
+            HostHttp::sendResponse(fd, 200, "text/plain", "SYSTEM CONTROL RELEASED");
+            return;
+        }
+
+        RobotCommand resolved;
+        const char *command = resolveCommand(target, action, speed, resolved);
+        if (strcmp(command, "UNKNOWN") == 0 || strcmp(command, "SERVOS STARTING") == 0)
+        {
+            noteClientRequest(request.clientIp);
+            HostHttp::sendResponse(fd, strcmp(command, "UNKNOWN") == 0 ? 400 : 503, "text/plain", command);
+            return;
+        }
+
+        SessionAdmission admission = admitClientCommand(request.clientIp, target, action, speed);
+        if (admission == SESSION_READ_ONLY)
+        {
+            HostHttp::sendResponse(fd, 403, "text/plain", "READ ONLY");
+            return;
+        }
+        if (admission == SESSION_COALESCED)
+        {
+            HostHttp::sendResponse(fd, 202, "text/plain", "COALESCED");
+            return;
+        }
+
+        applyCommand(resolved);
+        lastCommand = command;
+        HostHttp::sendResponse(fd, 200, "text/plain", command);
+    }
+
+    // Mirrors handleBatch() in robot_main_v2.ino.
+    void handleBatch(int fd, const HostHttp::Request &request)
+    {
+        char spec[RobotConst::BATCH_SPEC_MAX_LEN];
+        HostHttp::getArg(request, "cmds", spec, sizeof(spec));
+
+        char reply[256];
+        ResponseWriter out;
+        beginResponse(out, reply, sizeof(reply));
+
+        CommandBatch batch;
+        const char *failure = parseCommandBatch(spec, DEFAULT_WEB_SPEED, batch);
+        if (failure != nullptr)
+        {
+            noteClientRequest(request.clientIp);
+            appendResponseFormat(out, "%s AT %d", failure, batch.failedEntry);
+            HostHttp::sendResponse(fd, strcmp(failure, "SERVOS STARTING") == 0 ? 503 : 400, "text/plain", reply);
+            return;
+        }
+
+        SessionAdmission admission = admitClientBatch(request.clientIp);
+        if (admission == SESSION_READ_ONLY)
+        {
+            HostHttp::sendResponse(fd, 403, "text/plain", "READ ONLY");
+            return;
+        }
+        if (admission == SESSION_RATE_LIMITED)
+        {
+            HostHttp::sendResponse(fd, 429, "text/plain", "RATE LIMITED");
+            return;
+        }
+
+        applyCommandBatch(batch);
+        appendCommandBatchReply(out, batch);
+        lastCommand = batch.commands[batch.count - 1].reply;
+        HostHttp::sendResponse(fd, 200, "text/plain", reply);
+    }
+
+    // The parts of the firmware's /status this node actually runs.
+    void handleStatus(int fd, const HostHttp::Request &request)
+    {
+        noteClientRequest(request.clientIp);
+
+        ResponseWriter out;
+        beginResponse(out, statusBuffer, sizeof(statusBuffer));
+        appendResponse(out, "{\"last\":");
+        appendJsonString(out, lastCommand);
+        appendResponseFormat(out, ",\"motors\":{\"a\":%d,\"b\":%d}", getMotorASetpoint(), getMotorBSetpoint());
+        appendResponseFormat(out, ",\"servos\":{\"head\":%d,\"left_arm\":%d,\"right_arm\":%d,\"faulted\":%d}",
+                             getHeadServoAngle(), getLeftArmServoAngle(), getRightArmServoAngle(), countFaultedServos());
+        appendSessionStatus(out);
+        appendI2cStatus(out);
+        appendAudioStatus(out);
+        appendResponse(out, "}");
+
+        if (out.truncated)
+            HostHttp::sendResponse(fd, 500, "text/plain", "STATUS TRUNCATED");
+        else
+            HostHttp::sendResponse(fd, 200, "application/json", statusBuffer);
+    }
+
+    void serveHttpRequest(int listenFd)
+    {
+        HostHttp::Request request;
+        int fd = HostHttp::acceptRequest(listenFd, request, HTTP_READ_TIMEOUT_US);
+        if (fd < 0)
+            return;
+
+        HostHw::setNowUs(robotClockUs());
+        if (strcmp(request.path, "/cmd") == 0)
+            handleCommand(fd, request);
+        else if (strcmp(request.path, "/batch") == 0)
+            handleBatch(fd, request);
+        else if (strcmp(request.path, "/status") == 0)
+            handleStatus(fd, request);
+        else
+            HostHttp::sendResponse(fd, 404, "text/plain", "NOT FOUND");
+        HostHttp::close(fd);
+    }
+
+    void applyCoalescedCommand()
+    {
+        SessionCommand pending;
+        if (!takeCoalescedCommand(pending))
+            return;
+
+        const char *command = mapAndApplyCommand(pending.target, pending.action, pending.speed);
+        if (strcmp(command, "UNKNOWN") != 0)
+            lastCommand = command;
+    }
+
+    void parseArgs(int argc, char **argv)
+    {
+        for (int i = 1; i + 1 < argc; i += 2)
+        {
+            std::string flag = argv[i];
+            if (flag == "--port")
+                options.port = (uint16_t)atoi(argv[i + 1]);
+            else if (flag == "--http-port")
+                options.httpPort = (uint16_t)atoi(argv[i + 1]);
+            else if (flag == "--clock-offset-ms")
+                options.clockOffsetMs = atof(argv[i + 1]);
+            else if (flag == "--drift-ppm")
+                options.driftPpm = atof(argv[i + 1]);
+            else if (flag == "--exit-after-s")
+                options.exitAfterS = atof(argv[i + 1]);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    parseArgs(argc, argv);
+    startTime = std::chrono::steady_clock::now();
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    int fd = HostUdp::open(options.port);
+    if (fd < 0)
+    {
+        fprintf(stderr, "[node :%u] cannot bind UDP port\n", options.port);
+        return 1;
+    }
+
+    int httpFd = -1;
+    if (options.httpPort != 0)
+    {
+        httpFd = HostHttp::listen(options.httpPort);
+        if (httpFd < 0)
+        {
+            fprintf(stderr, "[node :%u] cannot listen on HTTP port %u\n", options.port, options.httpPort);
+            return 1;
+        }
+    }
+
+    HostHw::setNowUs(robotClockUs());
+    SimPca9685::reset();
+    initMotors();
+    initServoIOC();
+    initAutonomousDrive();
+    initClientSessions();
+    initAudio();
+    SyncProtocol::resetScheduler();
+
+    printf("[node :%u] clock offset %.1f ms, drift %.1f ppm\n", options.port, options.clockOffsetMs, options.driftPpm);
+    if (httpFd >= 0)
+        printf("[node :%u] HTTP on port %u\n", options.port, options.httpPort);
+    fflush(stdout);
+
+    uint64_t exitAtUs = options.exitAfterS > 0 ? robotClockUs() + (uint64_t)(options.exitAfterS * 1e6) : UINT64_MAX;
+    while (running && robotClockUs() < exitAtUs)
+    {
+        pollfd waitFds[2] = {{fd, POLLIN, 0}, {httpFd, POLLIN, 0}};
+        poll(waitFds, httpFd >= 0 ? 2 : 1, (int)(waitBudgetUs(robotClockUs()) / 1000));
+
+        if (waitFds[0].revents & POLLIN)
+        {
+            uint8_t packet[SyncProtocol::MAX_PACKET];
+            uint8_t reply[SyncProtocol::MAX_PACKET];
+            sockaddr_in from;
+
+            long len = HostUdp::receive(fd, packet, sizeof(packet), from, 0);
+            if (len > 0)
+            {
+                size_t replyLen = SyncProtocol::handleRobotPacket(packet, (size_t)len, robotClockUs(), robotClockUs,
+                                                                  reply, sizeof(reply));
+                if (replyLen > 0)
+                    HostUdp::sendTo(fd, from, reply, replyLen);
+            }
+        }
+
+        if (httpFd >= 0 && (waitFds[1].revents & POLLIN))
+            serveHttpRequest(httpFd);
+
+        applyDueCommands();
+        HostHw::setNowUs(robotClockUs());
+        applyCoalescedCommand();
+        updateServoIOC();
+        SimAudio::renderUntil(robotClockUs());
+    }
+
+    const SyncProtocol::SchedulerStats &stats = SyncProtocol::getSchedulerStats();
+    printf("[node :%u] received=%u executed=%u late=%u rejected=%u max_late_us=%u\n", options.port,
+           stats.received, stats.executed, stats.late, stats.rejected, stats.maxLatenessUs);
+
+    HostHttp::close(httpFd);
+    HostUdp::close(fd);
+    return 0;
+}
@@ -0,0 +1,6 @@
+#ifndef HOST_ADAFRUIT_GFX_SHIM_H
+#define HOST_ADAFRUIT_GFX_SHIM_H
+
+#include <Arduino.h>
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef HOST_ADAFRUIT_PWM_SERVO_DRIVER_SHIM_H
+#define HOST_ADAFRUIT_PWM_SERVO_DRIVER_SHIM_H
+
+#include <Arduino.h>
+
+class Adafruit_PWMServoDriver
+{
+public:
+    explicit Adafruit_PWMServoDriver(uint8_t address = 0x40) : address(address) {}
+    bool begin() { return true; }
+    void setPWMFreq(float) {}
+
+private:
+    uint8_t address;
+};
+
+#endif
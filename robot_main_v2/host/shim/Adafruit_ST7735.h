@@ -0,0 +1,113 @@
+#ifndef HOST_ADAFRUIT_ST7735_SHIM_H
+#define HOST_ADAFRUIT_ST7735_SHIM_H
+
+#include <Adafruit_GFX.h>
+
+#include "host_hw.h"
+
+// Counting stand-in for the ST7735 driver. Nothing is rendered; each call
+// adds the address windows and pixels Adafruit_GFX / Adafruit_SPITFT would
+// push over SPI for it, following their primitives (fast lines and rects
+// are one window, diagonal lines and glyph pixels are one window each).
+
+#define INITR_BLACKTAB 0x02
+
+class Adafruit_ST7735
+{
+public:
+    Adafruit_ST7735(int8_t, int8_t, int8_t, int8_t, int8_t) {}
+
+    void initR(uint8_t) {}
+    void setRotation(uint8_t) {}
+    void setTextColor(uint16_t) {}
+    void setTextSize(uint8_t size) { textSize = size; }
+    void setCursor(int16_t, int16_t) {}
+
+    void getTextBounds(const char *text, int16_t x, int16_t y, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h)
+    {
+        *x1 = x;
+        *y1 = y;
+        *w = (uint16_t)(strlen(text) * GLYPH_W * textSize);
+        *h = (uint16_t)(GLYPH_H * textSize);
+    }
+
+    // Approximates every glyph cell as fully lit, drawn pixel by pixel.
+    void print(const char *text)
+    {
+        uint64_t pixels = (uint64_t)strlen(text) * GLYPH_W * GLYPH_H * textSize * textSize;
+        count(pixels, pixels);
+    }
+
+    void fillScreen(uint16_t) { fillRect(0, 0, WIDTH, HEIGHT, 0); }
+    void fillRect(int16_t, int16_t, int16_t w, int16_t h, uint16_t) { count(1, (uint64_t)w * h); }
+    void drawFastHLine(int16_t, int16_t, int16_t w, uint16_t) { count(1, w); }
+    void drawFastVLine(int16_t, int16_t, int16_t h, uint16_t) { count(1, h); }
+
+    void drawRect(int16_t, int16_t, int16_t w, int16_t h, uint16_t)
+    {
+        count(4, 2ULL * w + 2ULL * h);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t)
+    {
+        if (x0 == x1)
+            return drawFastVLine(x0, y0, abs(y1 - y0) + 1, 0);
+        if (y0 == y1)
+            return drawFastHLine(x0, y0, abs(x1 - x0) + 1, 0);
+
+        uint64_t pixels = std::max(abs(x1 - x0), abs(y1 - y0)) + 1;
+        count(pixels, pixels);
+    }
+
+    // Same vertical-span walk as Adafruit_GFX::fillCircleHelper.
+    void fillCircle(int16_t, int16_t, int16_t r, uint16_t)
+    {
+        drawFastVLine(0, 0, 2 * r + 1, 0);
+
+        int16_t f = 1 - r;
+        int16_t ddFx = 1;
+        int16_t ddFy = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddFy += 2;
+                f += ddFy;
+            }
+            x++;
+            ddFx += 2;
+            f += ddFx;
+
+            if (x < y + 1)
+                count(2, 2ULL * (2 * y + 1));
+            if (y != py)
+            {
+                count(2, 2ULL * (2 * px + 1));
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+private:
+    static constexpr int16_t WIDTH = 128;
+    static constexpr int16_t HEIGHT = 160;
+    static constexpr int GLYPH_W = 6;
+    static constexpr int GLYPH_H = 8;
+
+    uint8_t textSize = 1;
+
+    static void count(uint64_t windows, uint64_t pixels)
+    {
+        HostHw::counters().spiWindows += windows;
+        HostHw::counters().spiPixels += pixels;
+    }
+};
+
+#endif
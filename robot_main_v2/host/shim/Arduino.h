@@ -0,0 +1,150 @@
+#ifndef HOST_ARDUINO_SHIM_H
+#define HOST_ARDUINO_SHIM_H
+
+// Host stand-in for the subset of the ESP32 Arduino core used by the
+// robot_main_v2 modules. Time and pins are driven by host_hw.h.
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define OUTPUT_OPEN_DRAIN 0x13
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define PI 3.1415926535897932384626433832795
+#define IRAM_ATTR
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+bool ledcAttachChannel(uint8_t pin, uint32_t freq, uint8_t resolution, int8_t channel);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterrupt(uint8_t pin, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t pin);
+void noInterrupts();
+void interrupts();
+
+template <typename T, typename L, typename H>
+T constrain(T value, L low, H high)
+{
+    return value < (T)low ? (T)low : (value > (T)high ? (T)high : value);
+}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    if (inMax == inMin)
+        return outMin;
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+class String
+{
+public:
+    String(const char *text = "") : value(text != nullptr ? text : "") {}
+    String(const std::string &text) : value(text) {}
+    String(char c) : value(1, c) {}
+    String(int number) : value(std::to_string(number)) {}
+    String(unsigned int number) : value(std::to_string(number)) {}
+    String(long number) : value(std::to_string(number)) {}
+    String(unsigned long number) : value(std::to_string(number)) {}
+    String(float number, unsigned int decimals = 2) : value(formatFloat(number, decimals)) {}
+    String(double number, unsigned int decimals = 2) : value(formatFloat(number, decimals)) {}
+
+    const char *c_str() const { return value.c_str(); }
+    unsigned int length() const { return (unsigned int)value.size(); }
+    long toInt() const { return strtol(value.c_str(), nullptr, 10); }
+    bool startsWith(const String &prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+
+    String &operator+=(const String &other)
+    {
+        value += other.value;
+        return *this;
+    }
+    String &operator+=(const char *other)
+    {
+        value += other;
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        value += c;
+        return *this;
+    }
+
+    friend String operator+(const String &a, const String &b) { return String(a.value + b.value); }
+    friend String operator+(const String &a, const char *b) { return String(a.value + b); }
+    friend String operator+(const char *a, const String &b) { return String(a + b.value); }
+    friend bool operator==(const String &a, const String &b) { return a.value == b.value; }
+    friend bool operator==(const String &a, const char *b) { return a.value == b; }
+    friend bool operator!=(const String &a, const char *b) { return a.value != b; }
+
+private:
+    static std::string formatFloat(double number, unsigned int decimals)
+    {
+        char buffer[48];
+        snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, number);
+        return buffer;
+    }
+
+    std::string value;
+};
+
+class HostSerial
+{
+public:
+    void begin(unsigned long) {}
+    void print(const char *text) { emit(text); }
+    void print(const String &text) { emit(text.c_str()); }
+    void print(int number) { emit(String(number).c_str()); }
+    void print(unsigned int number) { emit(String(number).c_str()); }
+    void print(long number) { emit(String(number).c_str()); }
+    void print(unsigned long number) { emit(String(number).c_str()); }
+    void print(double number) { emit(String(number).c_str()); }
+    template <typename T>
+    auto print(const T &value) -> decltype(value.toString(), void())
+    {
+        emit(value.toString().c_str());
+    }
+    void println() { emit("\n"); }
+    template <typename T>
+    void println(const T &value)
+    {
+        print(value);
+        emit("\n");
+    }
+
+private:
+    void emit(const char *text);
+};
+
+extern HostSerial Serial;
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef HOST_IPADDRESS_SHIM_H
+#define HOST_IPADDRESS_SHIM_H
+
+#include <Arduino.h>
+
+// Host stand-in for the ESP32 IPAddress. Holds the address in network order
+// like lwIP, so the first octet is the low byte.
+class IPAddress
+{
+public:
+    IPAddress(uint32_t address = 0) : address(address) {}
+
+    operator uint32_t() const { return address; }
+
+    String toString() const
+    {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", (unsigned)(address & 0xFF), (unsigned)((address >> 8) & 0xFF),
+                 (unsigned)((address >> 16) & 0xFF), (unsigned)(address >> 24));
+        return String(text);
+    }
+
+private:
+    uint32_t address;
+};
+
+#endif
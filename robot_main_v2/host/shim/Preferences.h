@@ -0,0 +1,78 @@
+#ifndef HOST_PREFERENCES_SHIM_H
+#define HOST_PREFERENCES_SHIM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Host stand-in for the ESP32 Preferences library: an in-memory NVS that
+// lives as long as the process. Keys are scoped by namespace like on flash.
+
+class Preferences
+{
+public:
+    bool begin(const char *name, bool readOnly = false)
+    {
+        scope = name;
+        this->readOnly = readOnly;
+        return true;
+    }
+
+    void end() {}
+
+    size_t putBytes(const char *key, const void *value, size_t len)
+    {
+        if (readOnly)
+            return 0;
+        const uint8_t *bytes = static_cast<const uint8_t *>(value);
+        store()[scope + "/" + key].assign(bytes, bytes + len);
+        return len;
+    }
+
+    size_t getBytesLength(const char *key)
+    {
+        auto it = store().find(scope + "/" + key);
+        return it == store().end() ? 0 : it->second.size();
+    }
+
+    size_t getBytes(const char *key, void *buf, size_t maxLen)
+    {
+        auto it = store().find(scope + "/" + key);
+        if (it == store().end() || it->second.size() > maxLen)
+            return 0;
+        memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
+    size_t putUChar(const char *key, uint8_t value)
+    {
+        return putBytes(key, &value, 1);
+    }
+
+    uint8_t getUChar(const char *key, uint8_t defaultValue = 0)
+    {
+        uint8_t value = defaultValue;
+        return getBytesLength(key) == 1 && getBytes(key, &value, 1) == 1 ? value : defaultValue;
+    }
+
+    bool remove(const char *key)
+    {
+        return !readOnly && store().erase(scope + "/" + key) > 0;
+    }
+
+private:
+    static std::map<std::string, std::vector<uint8_t>> &store()
+    {
+        static std::map<std::string, std::vector<uint8_t>> entries;
+        return entries;
+    }
+
+    std::string scope;
+    bool readOnly = false;
+};
+
+#endif
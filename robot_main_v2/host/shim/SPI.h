@@ -0,0 +1,6 @@
+#ifndef HOST_SPI_SHIM_H
+#define HOST_SPI_SHIM_H
+
+#include <Arduino.h>
+
+#endif
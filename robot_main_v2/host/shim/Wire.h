@@ -0,0 +1,18 @@
+#ifndef HOST_WIRE_SHIM_H
+#define HOST_WIRE_SHIM_H
+
+#include <Arduino.h>
+
+// Bus setup only; runtime transfers go through the i2c_queue.h stand-in.
+class TwoWire
+{
+public:
+    bool begin(int = -1, int = -1, uint32_t = 0) { return true; }
+    void end() {}
+    void setClock(uint32_t) {}
+    void setTimeOut(uint16_t) {}
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef HOST_ESP_HEAP_CAPS_SHIM_H
+#define HOST_ESP_HEAP_CAPS_SHIM_H
+
+#include <stddef.h>
+#include <string.h>
+
+// Host stand-in for the ESP-IDF heap statistics. There is no multi_heap on
+// the host, so every field reads as zero.
+
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+typedef struct
+{
+    size_t total_free_bytes;
+    size_t total_allocated_bytes;
+    size_t largest_free_block;
+    size_t minimum_free_bytes;
+    size_t allocated_blocks;
+    size_t free_blocks;
+    size_t total_blocks;
+} multi_heap_info_t;
+
+inline void heap_caps_get_info(multi_heap_info_t *info, unsigned int)
+{
+    memset(info, 0, sizeof(*info));
+}
+
+#endif
@@ -0,0 +1,164 @@
+#include <Arduino.h>
+
+#include "host_hw.h"
+
+HostSerial Serial;
+
+namespace
+{
+    uint64_t clockUs = 0;
+    int inputLevels[HostHw::PIN_COUNT] = {};
+    int outputLevels[HostHw::PIN_COUNT] = {};
+    uint32_t pwmDuties[HostHw::PIN_COUNT] = {};
+    void (*isrByPin[HostHw::PIN_COUNT])(void) = {};
+    HostHw::PinWriteHook pinWriteHook = nullptr;
+    HostHw::PwmWriteHook pwmWriteHook = nullptr;
+    HostHw::Counters hwCounters = {};
+    bool serialEcho = false;
+}
+
+namespace HostHw
+{
+    uint64_t nowUs()
+    {
+        return clockUs;
+    }
+
+    void setNowUs(uint64_t us)
+    {
+        clockUs = us;
+    }
+
+    void advanceUs(uint64_t us)
+    {
+        clockUs += us;
+    }
+
+    void setPinLevel(uint8_t pin, int level)
+    {
+        if (pin >= PIN_COUNT || inputLevels[pin] == level)
+            return;
+
+        inputLevels[pin] = level;
+        if (isrByPin[pin] != nullptr)
+            isrByPin[pin]();
+    }
+
+    int outputLevel(uint8_t pin)
+    {
+        return pin < PIN_COUNT ? outputLevels[pin] : LOW;
+    }
+
+    uint32_t pwmDuty(uint8_t pin)
+    {
+        return pin < PIN_COUNT ? pwmDuties[pin] : 0;
+    }
+
+    void setPinWriteHook(PinWriteHook hook)
+    {
+        pinWriteHook = hook;
+    }
+
+    void setPwmWriteHook(PwmWriteHook hook)
+    {
+        pwmWriteHook = hook;
+    }
+
+    Counters &counters()
+    {
+        return hwCounters;
+    }
+
+    void resetCounters()
+    {
+        hwCounters = Counters();
+    }
+
+    void setSerialEcho(bool enabled)
+    {
+        serialEcho = enabled;
+    }
+}
+
+void HostSerial::emit(const char *text)
+{
+    if (serialEcho)
+        fputs(text, stdout);
+}
+
+unsigned long millis()
+{
+    return (unsigned long)(clockUs / 1000);
+}
+
+unsigned long micros()
+{
+    return (unsigned long)clockUs;
+}
+
+void delay(uint32_t ms)
+{
+    clockUs += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    clockUs += us;
+}
+
+void yield()
+{
+}
+
+void pinMode(uint8_t, uint8_t)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+    hwCounters.gpioWrites++;
+    if (pin < HostHw::PIN_COUNT)
+        outputLevels[pin] = level;
+    if (pinWriteHook != nullptr)
+        pinWriteHook(pin, level);
+}
+
+int digitalRead(uint8_t pin)
+{
+    return pin < HostHw::PIN_COUNT ? inputLevels[pin] : LOW;
+}
+
+bool ledcAttachChannel(uint8_t, uint32_t, uint8_t, int8_t)
+{
+    return true;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty)
+{
+    hwCounters.pwmWrites++;
+    if (pin < HostHw::PIN_COUNT)
+        pwmDuties[pin] = duty;
+    if (pwmWriteHook != nullptr)
+        pwmWriteHook(pin, duty);
+    return true;
+}
+
+void attachInterrupt(uint8_t pin, void (*isr)(void), int)
+{
+    if (pin < HostHw::PIN_COUNT)
+        isrByPin[pin] = isr;
+}
+
+void detachInterrupt(uint8_t pin)
+{
+    if (pin < HostHw::PIN_COUNT)
+        isrByPin[pin] = nullptr;
+}
+
+void noInterrupts()
+{
+}
+
+void interrupts()
+{
+}
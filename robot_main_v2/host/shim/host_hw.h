@@ -0,0 +1,45 @@
+#ifndef HOST_HW_H
+#define HOST_HW_H
+
+#include <stdint.h>
+
+// Simulation-side controls for the Arduino shim: a virtual clock, pin levels
+// with edge interrupts, and counters of every hardware operation issued.
+
+namespace HostHw
+{
+    constexpr int PIN_COUNT = 40;
+
+    struct Counters
+    {
+        uint64_t gpioWrites;
+        uint64_t pwmWrites;
+        uint64_t i2cTransactions;
+        uint64_t i2cBytes;
+        uint64_t spiWindows;
+        uint64_t spiPixels;
+    };
+
+    typedef void (*PinWriteHook)(uint8_t pin, int level);
+    typedef void (*PwmWriteHook)(uint8_t pin, uint32_t duty);
+
+    uint64_t nowUs();
+    void setNowUs(uint64_t us);
+    void advanceUs(uint64_t us);
+
+    // Input side: changing a level fires the ISR attached to that pin.
+    void setPinLevel(uint8_t pin, int level);
+
+    // Output side: last values written by the firmware.
+    int outputLevel(uint8_t pin);
+    uint32_t pwmDuty(uint8_t pin);
+    void setPinWriteHook(PinWriteHook hook);
+    void setPwmWriteHook(PwmWriteHook hook);
+
+    Counters &counters();
+    void resetCounters();
+
+    void setSerialEcho(bool enabled);
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include "audio_clips.h"
+#include "audio_engine.h"
+#include "audio_mixer.h"
+#include "host_hw.h"
+#include "robot_constants.h"
+#include "sim_audio.h"
+
+namespace
+{
+    constexpr uint64_t BLOCK_US =
+        1000000ULL * RobotConst::AUDIO_BLOCK_FRAMES / RobotConst::AUDIO_SAMPLE_RATE;
+
+    bool ready = false;
+    bool playing = false;
+    uint64_t nextBlockUs = 0;
+    uint32_t blockCount = 0;
+}
+
+namespace SimAudio
+{
+    void renderUntil(uint64_t nowUs)
+    {
+        int16_t block[RobotConst::AUDIO_BLOCK_FRAMES];
+        while (playing && nextBlockUs <= nowUs)
+        {
+            playing = mixAudioBlock(block, RobotConst::AUDIO_BLOCK_FRAMES) > 0;
+            nextBlockUs += BLOCK_US;
+            blockCount++;
+        }
+    }
+
+    uint32_t blocksRendered()
+    {
+        return blockCount;
+    }
+}
+
+bool initAudio()
+{
+    resetAudioMixer();
+    ready = true;
+    playing = false;
+    blockCount = 0;
+    return true;
+}
+
+bool isAudioReady()
+{
+    return ready;
+}
+
+bool playSound(uint8_t clipId)
+{
+    if (!ready || clipId >= AUDIO_CLIP_COUNT)
+        return false;
+
+    if (!playing)
+        nextBlockUs = HostHw::nowUs();
+    startAudioVoice(&AUDIO_CLIPS[clipId]);
+    playing = true;
+    return true;
+}
+
+bool isAudioPlaying()
+{
+    return playing;
+}
+
+void appendAudioStatus(ResponseWriter &out)
+{
+    const AudioMixerStats &stats = getAudioMixerStats();
+    appendResponseFormat(out,
+                         ",\"audio\":{\"ready\":%s,\"playing\":%s,\"voices\":%d,\"started\":%lu,\"stolen\":%lu,"
+                         "\"dropped\":0,\"underruns\":0,\"clipped\":%lu,\"blocks\":%lu}",
+                         ready ? "true" : "false", playing ? "true" : "false", countActiveAudioVoices(),
+                         (unsigned long)stats.started, (unsigned long)stats.stolen,
+                         (unsigned long)stats.clippedSamples, (unsigned long)blockCount);
+}
@@ -0,0 +1,16 @@
+#ifndef SIM_AUDIO_H
+#define SIM_AUDIO_H
+
+#include <stdint.h>
+
+// Stand-in for audio_engine.cpp: triggers start mixer voices directly, and
+// blocks are mixed (and thrown away) as the caller's clock passes their
+// playback time, the way the audio task drains them on the robot.
+
+namespace SimAudio
+{
+    void renderUntil(uint64_t nowUs);
+    uint32_t blocksRendered();
+}
+
+#endif
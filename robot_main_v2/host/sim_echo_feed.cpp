@@ -0,0 +1,92 @@
+#include <Arduino.h>
+
+#include <random>
+#include <vector>
+
+#include "host_hw.h"
+#include "robot_constants.h"
+#include "sim_echo_feed.h"
+
+namespace
+{
+    constexpr uint64_t ECHO_START_DELAY_US = 450;
+    constexpr double SOUND_MM_PER_US = 0.343;
+    constexpr double MIN_ECHO_MM = 20.0;
+    // With nothing in range the real module still raises echo, for ~38 ms.
+    constexpr uint64_t NO_ECHO_WIDTH_US = 38000;
+
+    struct EchoEdge
+    {
+        uint64_t atUs;
+        int level;
+    };
+
+    SimEchoFeed::DistanceFn distanceFn = nullptr;
+    std::mt19937 rng;
+    double noiseMm = 0.0;
+    double spikeRate = 0.0;
+    std::vector<EchoEdge> pendingEdges;
+    int lastTrigLevel = LOW;
+
+    double sampleReadingMm()
+    {
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        if (unit(rng) < spikeRate)
+            return std::uniform_real_distribution<double>(50.0, RobotConst::RANGE_MAX_MM)(rng);
+
+        return distanceFn() + std::normal_distribution<double>(0.0, noiseMm)(rng);
+    }
+
+    void onPinWrite(uint8_t pin, int level)
+    {
+        if (pin != RobotPins::RANGE_TRIG_PIN)
+            return;
+
+        bool fallingEdge = lastTrigLevel == HIGH && level == LOW;
+        lastTrigLevel = level;
+        if (!fallingEdge || distanceFn == nullptr)
+            return;
+
+        double readingMm = sampleReadingMm();
+        uint64_t riseUs = HostHw::nowUs() + ECHO_START_DELAY_US;
+        uint64_t widthUs = readingMm >= RobotConst::RANGE_MAX_MM
+                               ? NO_ECHO_WIDTH_US
+                               : (uint64_t)(2.0 * std::max(readingMm, MIN_ECHO_MM) / SOUND_MM_PER_US);
+        pendingEdges.push_back({riseUs, HIGH});
+        pendingEdges.push_back({riseUs + widthUs, LOW});
+    }
+}
+
+namespace SimEchoFeed
+{
+    void begin(DistanceFn trueDistanceMm, unsigned seed, double noise, double spikes)
+    {
+        distanceFn = trueDistanceMm;
+        rng.seed(seed);
+        noiseMm = noise;
+        spikeRate = spikes;
+        HostHw::setPinWriteHook(onPinWrite);
+        reset();
+    }
+
+    void reset()
+    {
+        pendingEdges.clear();
+        lastTrigLevel = LOW;
+        HostHw::setPinLevel(RobotPins::RANGE_ECHO_PIN, LOW);
+    }
+
+    void runUntil(uint64_t untilUs)
+    {
+        // At most one ping is in flight, so the list stays tiny and ordered.
+        size_t delivered = 0;
+        while (delivered < pendingEdges.size() && pendingEdges[delivered].atUs <= untilUs)
+        {
+            HostHw::setNowUs(pendingEdges[delivered].atUs);
+            HostHw::setPinLevel(RobotPins::RANGE_ECHO_PIN, pendingEdges[delivered].level);
+            delivered++;
+        }
+        pendingEdges.erase(pendingEdges.begin(), pendingEdges.begin() + delivered);
+        HostHw::setNowUs(untilUs);
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef SIM_ECHO_FEED_H
+#define SIM_ECHO_FEED_H
+
+#include <stdint.h>
+
+// Synthetic HC-SR04: each trigger pulse written by range_sensor.cpp schedules
+// echo edges for the distance returned by the callback, with Gaussian noise
+// and occasional spike readings.
+
+namespace SimEchoFeed
+{
+    typedef double (*DistanceFn)();
+
+    void begin(DistanceFn trueDistanceMm, unsigned seed, double noiseMm, double spikeRate);
+    void reset();
+
+    // Delivers every echo edge up to untilUs, then leaves the clock there.
+    void runUntil(uint64_t untilUs);
+}
+
+#endif
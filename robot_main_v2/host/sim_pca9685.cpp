@@ -0,0 +1,85 @@
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "host_hw.h"
+#include "i2c_queue.h"
+#include "sim_pca9685.h"
+
+TwoWire Wire;
+
+namespace
+{
+    constexpr uint8_t BASE_ADDRESS = 0x40;
+    constexpr int BOARD_COUNT = 8;
+    constexpr uint8_t LED0_ON_L = 0x06;
+    constexpr uint8_t FULL_OFF_BIT = 0x10;
+
+    uint16_t offCounts[BOARD_COUNT][SimPca9685::CHANNELS];
+    uint32_t writeCount = 0;
+    bool writesFail = false;
+
+    void applyLedWrite(uint8_t board, uint8_t reg, const uint8_t *data, uint8_t len)
+    {
+        if (len != 4 || reg < LED0_ON_L || (reg - LED0_ON_L) % 4 != 0)
+            return;
+
+        int channel = (reg - LED0_ON_L) / 4;
+        if (channel >= SimPca9685::CHANNELS)
+            return;
+
+        uint16_t off = (uint16_t)(data[2] | ((data[3] & 0x0F) << 8));
+        offCounts[board][channel] = (data[3] & FULL_OFF_BIT) ? SimPca9685::FULL_OFF : off;
+    }
+}
+
+namespace SimPca9685
+{
+    void reset()
+    {
+        memset(offCounts, 0, sizeof(offCounts));
+        writeCount = 0;
+        writesFail = false;
+    }
+
+    void setWritesFail(bool fail)
+    {
+        writesFail = fail;
+    }
+
+    uint16_t offCount(uint8_t address, uint8_t channel)
+    {
+        int board = address - BASE_ADDRESS;
+        if (board < 0 || board >= BOARD_COUNT || channel >= CHANNELS)
+            return 0;
+
+        return offCounts[board][channel];
+    }
+}
+
+bool initI2cQueue()
+{
+    return true;
+}
+
+bool enqueueI2cWrite(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len,
+                     I2cDoneCallback onDone, void *context)
+{
+    HostHw::Counters &counters = HostHw::counters();
+    counters.i2cTransactions++;
+    counters.i2cBytes += 2 + len;
+    writeCount++;
+
+    int board = address - BASE_ADDRESS;
+    bool ok = !writesFail && board >= 0 && board < BOARD_COUNT;
+    if (ok)
+        applyLedWrite((uint8_t)board, reg, data, len);
+
+    if (onDone != nullptr)
+        onDone(ok, context);
+    return true;
+}
+
+void appendI2cStatus(ResponseWriter &out)
+{
+    appendResponseFormat(out, ",\"i2c\":{\"sim_writes\":%lu}", (unsigned long)writeCount);
+}
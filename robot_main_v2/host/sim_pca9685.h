@@ -0,0 +1,23 @@
+#ifndef SIM_PCA9685_H
+#define SIM_PCA9685_H
+
+#include <stdint.h>
+
+// Stand-in for i2c_queue.cpp: every enqueued write completes immediately
+// against a register model of PCA9685 boards at 0x40..0x47.
+
+namespace SimPca9685
+{
+    constexpr int CHANNELS = 16;
+    constexpr uint16_t FULL_OFF = 4096;
+
+    void reset();
+
+    // OFF count of a channel: 0 if never written, FULL_OFF once released.
+    uint16_t offCount(uint8_t address, uint8_t channel);
+
+    // While set, every write reports failure, like a board missing from the bus.
+    void setWritesFail(bool fail);
+}
+
+#endif
@@ -0,0 +1,178 @@
+#include <Wire.h>
+
+#include "i2c_queue.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr uint8_t MAX_PAYLOAD = 4;
+    constexpr int BUS_RECOVERY_CLOCKS = 9;
+    constexpr uint32_t BUS_RECOVERY_HALF_PERIOD_US = 5;
+    constexpr uint32_t TASK_STACK_SIZE = 3072;
+
+    struct I2cRequest
+    {
+        uint8_t address;
+        uint8_t reg;
+        uint8_t len;
+        uint8_t data[MAX_PAYLOAD];
+        I2cDoneCallback onDone;
+        void *context;
+        uint32_t enqueuedUs;
+    };
+
+    QueueHandle_t requestQueue = nullptr;
+
+    // Each counter has a single writer task; 32-bit reads are atomic.
+    volatile uint32_t enqueuedCount = 0;
+    volatile uint32_t completedCount = 0;
+    volatile uint32_t failedCount = 0;
+    volatile uint32_t retryCount = 0;
+    volatile uint32_t droppedCount = 0;
+    volatile uint32_t busRecoveryCount = 0;
+    volatile uint32_t avgLatencyUs = 0;
+    volatile uint32_t maxLatencyUs = 0;
+
+    uint8_t transmit(const I2cRequest &request)
+    {
+        Wire.beginTransmission(request.address);
+        Wire.write(request.reg);
+        Wire.write(request.data, request.len);
+        return Wire.endTransmission();
+    }
+
+    // A slave that lost a clock mid-byte can hold SDA low forever; clocking
+    // SCL until it lets go and issuing a STOP frees the bus again.
+    void recoverBusIfStuck()
+    {
+        const uint8_t sda = RobotPins::SERVO_I2C_SDA_PIN;
+        const uint8_t scl = RobotPins::SERVO_I2C_SCL_PIN;
+
+        if (digitalRead(sda) == HIGH)
+            return;
+
+        Wire.end();
+        pinMode(sda, INPUT_PULLUP);
+        pinMode(scl, OUTPUT_OPEN_DRAIN);
+        digitalWrite(scl, HIGH);
+
+        for (int i = 0; i < BUS_RECOVERY_CLOCKS && digitalRead(sda) == LOW; i++)
+        {
+            digitalWrite(scl, LOW);
+            delayMicroseconds(BUS_RECOVERY_HALF_PERIOD_US);
+            digitalWrite(scl, HIGH);
+            delayMicroseconds(BUS_RECOVERY_HALF_PERIOD_US);
+        }
+
+        pinMode(sda, OUTPUT_OPEN_DRAIN);
+        digitalWrite(sda, LOW);
+        delayMicroseconds(BUS_RECOVERY_HALF_PERIOD_US);
+        digitalWrite(sda, HIGH);
+        delayMicroseconds(BUS_RECOVERY_HALF_PERIOD_US);
+
+        busRecoveryCount++;
+        Wire.begin(sda, scl, RobotConst::I2C_CLOCK_HZ);
+        Wire.setTimeOut(RobotConst::I2C_TIMEOUT_MS);
+    }
+
+    void recordLatency(uint32_t latencyUs)
+    {
+        avgLatencyUs = (avgLatencyUs * 7 + latencyUs) / 8;
+        if (latencyUs > maxLatencyUs)
+            maxLatencyUs = latencyUs;
+    }
+
+    // The ESP32 I2C driver blocks on its transfer-complete interrupt, so this
+    // task sleeps while the hardware shifts bytes and the loop keeps running.
+    void i2cWorkerTask(void *)
+    {
+        I2cRequest request;
+
+        for (;;)
+        {
+            if (xQueueReceive(requestQueue, &request, portMAX_DELAY) != pdTRUE)
+                continue;
+
+            uint8_t error = transmit(request);
+            for (int attempt = 0; error != 0 && attempt < RobotConst::I2C_MAX_RETRIES; attempt++)
+            {
+                retryCount++;
+                recoverBusIfStuck();
+                vTaskDelay(1);
+                error = transmit(request);
+            }
+
+            bool ok = (error == 0);
+            if (ok)
+                completedCount++;
+            else
+                failedCount++;
+
+            recordLatency(micros() - request.enqueuedUs);
+
+            if (request.onDone != nullptr)
+                request.onDone(ok, request.context);
+        }
+    }
+}
+
+bool initI2cQueue()
+{
+    if (requestQueue != nullptr)
+        return true;
+
+    Wire.setClock(RobotConst::I2C_CLOCK_HZ);
+    Wire.setTimeOut(RobotConst::I2C_TIMEOUT_MS);
+
+    requestQueue = xQueueCreate(RobotConst::I2C_QUEUE_DEPTH, sizeof(I2cRequest));
+    if (requestQueue == nullptr)
+        return false;
+
+    BaseType_t created = xTaskCreatePinnedToCore(
+        i2cWorkerTask,
+        "i2c_queue",
+        TASK_STACK_SIZE,
+        nullptr,
+        RobotConst::I2C_TASK_PRIORITY,
+        nullptr,
+        RobotConst::I2C_TASK_CORE);
+
+    return created == pdPASS;
+}
+
+bool enqueueI2cWrite(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len,
+                     I2cDoneCallback onDone, void *context)
+{
+    if (requestQueue == nullptr || len > MAX_PAYLOAD)
+        return false;
+
+    I2cRequest request;
+    request.address = address;
+    request.reg = reg;
+    request.len = len;
+    memcpy(request.data, data, len);
+    request.onDone = onDone;
+    request.context = context;
+    request.enqueuedUs = micros();
+
+    if (xQueueSend(requestQueue, &request, 0) != pdTRUE)
+    {
+        droppedCount++;
+        return false;
+    }
+
+    enqueuedCount++;
+    return true;
+}
+
+void appendI2cStatus(ResponseWriter &out)
+{
+    uint32_t depth = requestQueue != nullptr ? uxQueueMessagesWaiting(requestQueue) : 0;
+
+    appendResponseFormat(out,
+                         ",\"i2c\":{\"enq\":%lu,\"ok\":%lu,\"fail\":%lu,\"retry\":%lu,\"drop\":%lu,"
+                         "\"recover\":%lu,\"depth\":%lu,\"lat_us_avg\":%lu,\"lat_us_max\":%lu}",
+                         (unsigned long)enqueuedCount, (unsigned long)completedCount, (unsigned long)failedCount,
+                         (unsigned long)retryCount, (unsigned long)droppedCount, (unsigned long)busRecoveryCount,
+                         (unsigned long)depth, (unsigned long)avgLatencyUs, (unsigned long)maxLatencyUs);
+}
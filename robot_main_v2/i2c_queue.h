@@ -0,0 +1,16 @@
+#ifndef I2C_QUEUE_H
+#define I2C_QUEUE_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+// Completion callbacks run on the I2C worker task, keep them short.
+typedef void (*I2cDoneCallback)(bool ok, void *context);
+
+bool initI2cQueue();
+bool enqueueI2cWrite(uint8_t address, uint8_t reg, const uint8_t *data, uint8_t len,
+                     I2cDoneCallback onDone = nullptr, void *context = nullptr);
+void appendI2cStatus(ResponseWriter &out);
+
+#endif
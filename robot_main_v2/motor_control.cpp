@@ -1,6 +1,12 @@
 #include "motor_control.h"
 #include "robot_constants.h"
 
+namespace
+{
+    int motorASetpoint = 0;
+    int motorBSetpoint = 0;
+}
+
 void initMotors()
 {
     pinMode(RobotPins::IN1_PIN, OUTPUT);
@@ -19,6 +25,7 @@ void setMotorA(bool fwd, uint8_t spd)
     digitalWrite(RobotPins::IN1_PIN, actualFwd ? HIGH : LOW);
     digitalWrite(RobotPins::IN2_PIN, actualFwd ? LOW : HIGH);
     ledcWrite(RobotPins::ENA_PIN, spd);
+    motorASetpoint = fwd ? spd : -spd;
 }
 
 void setMotorB(bool fwd, uint8_t spd)
@@ -27,6 +34,7 @@ void setMotorB(bool fwd, uint8_t spd)
     digitalWrite(RobotPins::IN3_PIN, actualFwd ? HIGH : LOW);
     digitalWrite(RobotPins::IN4_PIN, actualFwd ? LOW : HIGH);
     ledcWrite(RobotPins::ENB_PIN, spd);
+    motorBSetpoint = fwd ? spd : -spd;
 }
 
 void stopMotors()
@@ -37,6 +45,8 @@ void stopMotors()
     digitalWrite(RobotPins::IN4_PIN, LOW);
     ledcWrite(RobotPins::ENA_PIN, 0);
     ledcWrite(RobotPins::ENB_PIN, 0);
+    motorASetpoint = 0;
+    motorBSetpoint = 0;
 }
 
 void driveTank(int leftSpeed, int rightSpeed)
@@ -49,6 +59,7 @@ void driveTank(int leftSpeed, int rightSpeed)
         digitalWrite(RobotPins::IN1_PIN, LOW);
         digitalWrite(RobotPins::IN2_PIN, LOW);
         ledcWrite(RobotPins::ENA_PIN, 0);
+        motorASetpoint = 0;
     }
     else
     {
@@ -60,9 +71,25 @@ void driveTank(int leftSpeed, int rightSpeed)
         digitalWrite(RobotPins::IN3_PIN, LOW);
         digitalWrite(RobotPins::IN4_PIN, LOW);
         ledcWrite(RobotPins::ENB_PIN, 0);
+        motorBSetpoint = 0;
     }
     else
     {
         setMotorB(rightSpeed > 0, (uint8_t)abs(rightSpeed));
     }
 }
+
+bool areMotorsRunning()
+{
+    return motorASetpoint != 0 || motorBSetpoint != 0;
+}
+
+int getMotorASetpoint()
+{
+    return motorASetpoint;
+}
+
+int getMotorBSetpoint()
+{
+    return motorBSetpoint;
+}
@@ -8,5 +8,8 @@ void setMotorA(bool fwd, uint8_t spd);
 void setMotorB(bool fwd, uint8_t spd);
 void stopMotors();
 void driveTank(int leftSpeed, int rightSpeed);
+bool areMotorsRunning();
+int getMotorASetpoint();
+int getMotorBSetpoint();
 
 #endif
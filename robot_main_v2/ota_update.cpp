@@ -0,0 +1,262 @@
+#include <Arduino.h>
+#include <Update.h>
+#include <esp_ota_ops.h>
+#include <esp32/rom/miniz.h>
+
+#include "ota_update.h"
+
+// Keep the new image in PENDING_VERIFY until setup() reports a healthy boot,
+// so a crash or reset before that point makes the bootloader roll back.
+extern "C" bool verifyRollbackLater()
+{
+    return true;
+}
+
+namespace
+{
+    constexpr size_t INFLATE_WINDOW_SIZE = TINFL_LZ_DICT_SIZE;
+    constexpr int INFLATE_FLAGS = TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_HAS_MORE_INPUT | TINFL_FLAG_COMPUTE_ADLER32;
+    constexpr size_t MD5_HEX_LENGTH = 32;
+
+    tinfl_decompressor *inflator = nullptr;
+    uint8_t *window = nullptr;
+    size_t windowPos = 0;
+
+    bool otaActive = false;
+    bool otaSucceeded = false;
+    bool streamDone = false;
+    const char *lastError = "none";
+
+    unsigned long startMs = 0;
+    unsigned long elapsedMs = 0;
+    size_t compressedBytes = 0;
+    size_t imageBytes = 0;
+    unsigned long flashWriteUs = 0;
+
+    bool isBootPendingVerify()
+    {
+        const esp_partition_t *running = esp_ota_get_running_partition();
+        esp_ota_img_states_t state;
+        if (esp_ota_get_state_partition(running, &state) != ESP_OK)
+            return false;
+
+        return state == ESP_OTA_IMG_PENDING_VERIFY;
+    }
+
+    void releaseBuffers()
+    {
+        free(inflator);
+        free(window);
+        inflator = nullptr;
+        window = nullptr;
+    }
+
+    bool failOta(const char *reason)
+    {
+        lastError = reason;
+        Serial.print("[ERROR] OTA: ");
+        Serial.println(reason);
+
+        if (Update.isRunning())
+            Update.abort();
+
+        releaseBuffers();
+        otaActive = false;
+        otaSucceeded = false;
+        elapsedMs = millis() - startMs;
+        return false;
+    }
+
+    bool writeImageBlock(uint8_t *data, size_t len)
+    {
+        unsigned long writeStartUs = micros();
+        size_t written = Update.write(data, len);
+        flashWriteUs += micros() - writeStartUs;
+        imageBytes += written;
+
+        return written == len;
+    }
+
+    // Integer math: the report goes through ResponseWriter, which keeps off
+    // newlib's allocating float formatter.
+    unsigned long bytesPerSecond(size_t bytes, unsigned long micros)
+    {
+        if (micros == 0)
+            return 0;
+
+        return (unsigned long)((uint64_t)bytes * 1000000ULL / micros);
+    }
+}
+
+void initOtaUpdate()
+{
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    Serial.print("[INFO] OTA: running from partition ");
+    Serial.println(running != nullptr ? running->label : "?");
+
+    if (isBootPendingVerify())
+        Serial.println("[INFO] OTA: new image pending verification");
+}
+
+bool beginOtaUpdate(const char *expectedMd5)
+{
+    if (otaActive)
+        abortOtaUpdate();
+
+    startMs = millis();
+    elapsedMs = 0;
+    compressedBytes = 0;
+    imageBytes = 0;
+    flashWriteUs = 0;
+    windowPos = 0;
+    streamDone = false;
+    otaSucceeded = false;
+    lastError = "none";
+
+    if (expectedMd5 == nullptr || strlen(expectedMd5) != MD5_HEX_LENGTH)
+        return failOta("md5 of the uncompressed image is required");
+
+    inflator = static_cast<tinfl_decompressor *>(malloc(sizeof(tinfl_decompressor)));
+    window = static_cast<uint8_t *>(malloc(INFLATE_WINDOW_SIZE));
+    if (inflator == nullptr || window == nullptr)
+        return failOta("out of memory for inflate buffers");
+
+    tinfl_init(inflator);
+
+    if (!Update.begin(UPDATE_SIZE_UNKNOWN, U_FLASH))
+        return failOta("no inactive OTA partition available");
+
+    if (!Update.setMD5(expectedMd5))
+        return failOta("malformed md5");
+
+    otaActive = true;
+    Serial.println("[INFO] OTA: update started");
+    return true;
+}
+
+bool writeOtaChunk(const uint8_t *data, size_t len)
+{
+    if (!otaActive)
+        return false;
+
+    compressedBytes += len;
+
+    size_t inOffset = 0;
+    while (inOffset < len || !streamDone)
+    {
+        if (streamDone)
+            return failOta("trailing data after compressed stream");
+
+        size_t inBytes = len - inOffset;
+        size_t outBytes = INFLATE_WINDOW_SIZE - windowPos;
+        tinfl_status status = tinfl_decompress(
+            inflator,
+            data + inOffset,
+            &inBytes,
+            window,
+            window + windowPos,
+            &outBytes,
+            INFLATE_FLAGS);
+        inOffset += inBytes;
+
+        if (outBytes > 0)
+        {
+            if (!writeImageBlock(window + windowPos, outBytes))
+                return failOta("flash write failed");
+            windowPos = (windowPos + outBytes) & (INFLATE_WINDOW_SIZE - 1);
+        }
+
+        if (status < TINFL_STATUS_DONE)
+            return failOta("corrupt compressed stream");
+
+        if (status == TINFL_STATUS_DONE)
+            streamDone = true;
+        else if (status == TINFL_STATUS_NEEDS_MORE_INPUT)
+            break;
+    }
+
+    return true;
+}
+
+bool finishOtaUpdate()
+{
+    if (!otaActive)
+        return false;
+
+    if (!streamDone)
+        return failOta("compressed stream truncated");
+
+    if (!Update.end())
+        return failOta(Update.getError() == UPDATE_ERROR_MD5 ? "md5 mismatch" : "image verification failed");
+
+    releaseBuffers();
+    otaActive = false;
+    otaSucceeded = true;
+    elapsedMs = millis() - startMs;
+
+    char report[192];
+    ResponseWriter out;
+    beginResponse(out, report, sizeof(report));
+    appendOtaReport(out);
+    Serial.print("[INFO] ");
+    Serial.println(report);
+    return true;
+}
+
+void abortOtaUpdate()
+{
+    if (!otaActive)
+        return;
+
+    failOta("upload aborted");
+}
+
+bool isOtaUpdateActive()
+{
+    return otaActive;
+}
+
+bool isOtaUpdateSucceeded()
+{
+    return !otaActive && otaSucceeded;
+}
+
+void appendOtaReport(ResponseWriter &out)
+{
+    if (otaActive)
+    {
+        appendResponse(out, "OTA IN PROGRESS");
+        return;
+    }
+
+    if (!otaSucceeded)
+    {
+        appendResponseFormat(out, "OTA FAILED: %s", lastError);
+        return;
+    }
+
+    unsigned ratioX100 = compressedBytes > 0 ? (unsigned)((uint64_t)imageBytes * 100 / compressedBytes) : 0;
+    appendResponseFormat(out,
+                         "OTA OK image=%uB compressed=%uB ratio_x100=%u transfer_Bps=%lu flash_write_Bps=%lu elapsed=%lums",
+                         (unsigned)imageBytes, (unsigned)compressedBytes, ratioX100,
+                         bytesPerSecond(compressedBytes, elapsedMs * 1000UL), bytesPerSecond(imageBytes, flashWriteUs),
+                         elapsedMs);
+}
+
+void confirmOtaBootHealthy()
+{
+    if (!isBootPendingVerify())
+        return;
+
+    esp_ota_mark_app_valid_cancel_rollback();
+    Serial.println("[INFO] OTA: new image marked valid");
+}
+
+void rollbackOtaBootIfPending()
+{
+    if (!isBootPendingVerify())
+        return;
+
+    Serial.println("[ERROR] OTA: new image failed to boot, rolling back");
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+}
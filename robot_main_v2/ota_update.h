@@ -0,0 +1,19 @@
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+void initOtaUpdate();
+bool beginOtaUpdate(const char *expectedMd5);
+bool writeOtaChunk(const uint8_t *data, size_t len);
+bool finishOtaUpdate();
+void abortOtaUpdate();
+bool isOtaUpdateActive();
+bool isOtaUpdateSucceeded();
+void appendOtaReport(ResponseWriter &out);
+void confirmOtaBootHealthy();
+void rollbackOtaBootIfPending();
+
+#endif
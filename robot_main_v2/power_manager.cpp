@@ -0,0 +1,159 @@
+#include <WiFi.h>
+
+#include "power_manager.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr int POWER_STATE_COUNT = 3;
+    constexpr wifi_power_t ACTIVE_TX_POWER = WIFI_POWER_19_5dBm;
+    constexpr wifi_power_t LOW_TX_POWER = WIFI_POWER_8_5dBm;
+
+    PowerState powerState = POWER_ACTIVE;
+    unsigned long stateSinceMs = 0;
+    unsigned long lastActivityMs = 0;
+    unsigned long residencyMs[POWER_STATE_COUNT] = {};
+    TaskHandle_t loopTask = nullptr;
+
+    const char *powerStateName(PowerState state)
+    {
+        switch (state)
+        {
+        case POWER_ACTIVE:
+            return "active";
+        case POWER_IDLE:
+            return "idle";
+        case POWER_LOW:
+        default:
+            return "low";
+        }
+    }
+
+    unsigned long maxTickForState(PowerState state)
+    {
+        switch (state)
+        {
+        case POWER_ACTIVE:
+            return RobotConst::ACTIVE_TICK_MS;
+        case POWER_IDLE:
+            return RobotConst::IDLE_MAX_TICK_MS;
+        case POWER_LOW:
+        default:
+            return RobotConst::LOW_POWER_MAX_TICK_MS;
+        }
+    }
+
+    // A client can reach the web server through the AP or, with a show
+    // network configured, through the station side.
+    bool isWebClientReachable()
+    {
+        return WiFi.softAPgetStationNum() > 0 || WiFi.isConnected();
+    }
+
+    // Joins and leaves on either side wake the loop early instead of waiting
+    // out the tick, so it leaves the long low-power tick right away.
+    void onStationEvent(arduino_event_id_t event, arduino_event_info_t info)
+    {
+        wakePowerLoop();
+    }
+
+    void enterState(PowerState next, unsigned long now)
+    {
+        if (next == powerState)
+            return;
+
+        residencyMs[powerState] += now - stateSinceMs;
+        stateSinceMs = now;
+
+        uint32_t cpuMhz = (next == POWER_ACTIVE) ? RobotConst::ACTIVE_CPU_MHZ : RobotConst::IDLE_CPU_MHZ;
+        if (getCpuFrequencyMhz() != cpuMhz)
+            setCpuFrequencyMhz(cpuMhz);
+
+        // Radio power is owned here. The soft AP has to keep beaconing, so
+        // it cannot modem-sleep; with no station attached the next best
+        // saving is a lower TX power.
+        WiFi.setTxPower(next == POWER_LOW ? LOW_TX_POWER : ACTIVE_TX_POWER);
+
+        powerState = next;
+        Serial.print("[INFO] Power: ");
+        Serial.println(powerStateName(next));
+    }
+}
+
+void initPowerManager()
+{
+    loopTask = xTaskGetCurrentTaskHandle();
+    stateSinceMs = millis();
+    lastActivityMs = stateSinceMs;
+    powerState = POWER_ACTIVE;
+
+    // Modem sleep only applies to the station interface (the show network).
+    // It would delay choreography packets by up to a beacon interval while
+    // saving nothing, since the AP keeps the radio on anyway.
+    WiFi.setSleep(WIFI_PS_NONE);
+
+    WiFi.onEvent(onStationEvent, ARDUINO_EVENT_WIFI_AP_STACONNECTED);
+    WiFi.onEvent(onStationEvent, ARDUINO_EVENT_WIFI_AP_STADISCONNECTED);
+    WiFi.onEvent(onStationEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onStationEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+}
+
+void notePowerActivity()
+{
+    unsigned long now = millis();
+    lastActivityMs = now;
+    enterState(POWER_ACTIVE, now);
+}
+
+void updatePowerManager(bool actuatorsBusy)
+{
+    unsigned long now = millis();
+    if (actuatorsBusy)
+        lastActivityMs = now;
+
+    PowerState next = POWER_ACTIVE;
+    if (now - lastActivityMs >= RobotConst::IDLE_AFTER_MS)
+        next = isWebClientReachable() ? POWER_IDLE : POWER_LOW;
+
+    enterState(next, now);
+}
+
+void wakePowerLoop()
+{
+    if (loopTask != nullptr)
+        xTaskNotifyGive(loopTask);
+}
+
+void waitForNextTick(unsigned long nextDeadlineMs)
+{
+    unsigned long waitMs = min(maxTickForState(powerState), nextDeadlineMs);
+    if (waitMs == 0)
+        waitMs = 1;
+
+    // Blocking on the task notification lets the idle task clock-gate the
+    // CPU until the next deadline or a network event.
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+}
+
+PowerState getPowerState()
+{
+    return powerState;
+}
+
+void appendPowerStatus(ResponseWriter &out)
+{
+    unsigned long now = millis();
+
+    appendResponseFormat(out, ",\"power\":{\"state\":\"%s\",\"cpu_mhz\":%lu,\"residency_ms\":{",
+                         powerStateName(powerState), (unsigned long)getCpuFrequencyMhz());
+    for (int i = 0; i < POWER_STATE_COUNT; i++)
+    {
+        unsigned long total = residencyMs[i];
+        if (i == powerState)
+            total += now - stateSinceMs;
+
+        appendResponseFormat(out, "%s\"%s\":%lu", i > 0 ? "," : "",
+                             powerStateName(static_cast<PowerState>(i)), total);
+    }
+    appendResponse(out, "}}");
+}
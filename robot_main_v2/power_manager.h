@@ -0,0 +1,23 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+enum PowerState
+{
+    POWER_ACTIVE,
+    POWER_IDLE,
+    POWER_LOW
+};
+
+void initPowerManager();
+void notePowerActivity();
+void updatePowerManager(bool actuatorsBusy);
+void waitForNextTick(unsigned long nextDeadlineMs);
+void wakePowerLoop();
+PowerState getPowerState();
+void appendPowerStatus(ResponseWriter &out);
+
+#endif
@@ -0,0 +1,179 @@
+#include "range_sensor.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr uint32_t TRIGGER_PULSE_US = 10;
+    constexpr int MEDIAN_WINDOW = 3;
+
+    // Echo edges are timestamped in the ISR; the loop only picks up the
+    // finished pulse width, so a ping never blocks for the echo.
+    volatile uint32_t echoRiseUs = 0;
+    volatile uint32_t echoWidthUs = 0;
+    volatile bool echoReady = false;
+    // Edges only count between a trigger and its timeout, and a falling edge
+    // only after a rising one from the same ping.
+    volatile bool echoArmed = false;
+    volatile bool echoRiseSeen = false;
+
+    bool pingPending = false;
+    unsigned long lastPingMs = 0;
+
+    uint16_t rawSamples[MEDIAN_WINDOW];
+    int rawCount = 0;
+    int rawNext = 0;
+
+    uint16_t filteredMm = RobotConst::RANGE_MAX_MM;
+    unsigned long sampleMs = 0;
+    bool hasSample = false;
+
+    uint32_t echoCount = 0;
+    uint32_t timeoutCount = 0;
+
+    void IRAM_ATTR onEchoEdge()
+    {
+        uint32_t now = micros();
+        if (!echoArmed)
+            return;
+
+        if (digitalRead(RobotPins::RANGE_ECHO_PIN) == HIGH)
+        {
+            echoRiseUs = now;
+            echoRiseSeen = true;
+        }
+        else if (echoRiseSeen)
+        {
+            echoWidthUs = now - echoRiseUs;
+            echoArmed = false;
+            echoReady = true;
+        }
+    }
+
+    uint16_t echoWidthToMm(uint32_t widthUs)
+    {
+        uint32_t mm = widthUs * 343UL / 2000UL;
+        return mm > RobotConst::RANGE_MAX_MM ? RobotConst::RANGE_MAX_MM : (uint16_t)mm;
+    }
+
+    uint16_t medianOfWindow()
+    {
+        uint16_t a = rawSamples[0];
+        uint16_t b = rawSamples[1];
+        uint16_t c = rawSamples[2];
+        return max(min(a, b), min(max(a, b), c));
+    }
+
+    // Median-of-3 rejects single-ping spikes while keeping the worst-case
+    // reaction to a real step at two ping intervals.
+    void addSample(uint16_t mm, unsigned long now)
+    {
+        rawSamples[rawNext] = mm;
+        rawNext = (rawNext + 1) % MEDIAN_WINDOW;
+        if (rawCount < MEDIAN_WINDOW)
+            rawCount++;
+
+        // Publish nothing until the window is full, so a spike in the first
+        // pings cannot get through unfiltered.
+        if (rawCount < MEDIAN_WINDOW)
+            return;
+
+        filteredMm = medianOfWindow();
+        sampleMs = now;
+        hasSample = true;
+    }
+
+    void firePing(unsigned long now)
+    {
+        noInterrupts();
+        echoRiseSeen = false;
+        echoArmed = true;
+        interrupts();
+
+        digitalWrite(RobotPins::RANGE_TRIG_PIN, HIGH);
+        delayMicroseconds(TRIGGER_PULSE_US);
+        digitalWrite(RobotPins::RANGE_TRIG_PIN, LOW);
+
+        pingPending = true;
+        lastPingMs = now;
+    }
+}
+
+void initRangeSensor()
+{
+    pinMode(RobotPins::RANGE_TRIG_PIN, OUTPUT);
+    digitalWrite(RobotPins::RANGE_TRIG_PIN, LOW);
+    pinMode(RobotPins::RANGE_ECHO_PIN, INPUT);
+    attachInterrupt(digitalPinToInterrupt(RobotPins::RANGE_ECHO_PIN), onEchoEdge, CHANGE);
+
+    pingPending = false;
+    echoArmed = false;
+    echoReady = false;
+    rawCount = 0;
+    rawNext = 0;
+    hasSample = false;
+    filteredMm = RobotConst::RANGE_MAX_MM;
+}
+
+void updateRangeSensor()
+{
+    unsigned long now = millis();
+
+    if (echoReady)
+    {
+        noInterrupts();
+        uint32_t widthUs = echoWidthUs;
+        echoReady = false;
+        interrupts();
+
+        pingPending = false;
+        echoCount++;
+        addSample(echoWidthToMm(widthUs), now);
+    }
+    else if (pingPending && now - lastPingMs >= RobotConst::RANGE_ECHO_TIMEOUT_MS)
+    {
+        // No echo inside the timeout means nothing within range. Disarming
+        // drops a late edge instead of reading it as the next ping's echo.
+        noInterrupts();
+        echoArmed = false;
+        bool echoJustFinished = echoReady;
+        interrupts();
+
+        // An echo that finished since the check above is taken next tick.
+        if (!echoJustFinished)
+        {
+            pingPending = false;
+            timeoutCount++;
+            addSample(RobotConst::RANGE_MAX_MM, now);
+        }
+    }
+
+    if (!pingPending && now - lastPingMs >= RobotConst::RANGE_PING_INTERVAL_MS)
+        firePing(now);
+}
+
+bool isRangeReadingFresh()
+{
+    return hasSample && millis() - sampleMs < RobotConst::RANGE_STALE_MS;
+}
+
+uint16_t getRangeDistanceMm()
+{
+    return filteredMm;
+}
+
+unsigned long getRangeSampleMs()
+{
+    return sampleMs;
+}
+
+void appendRangeStatus(ResponseWriter &out)
+{
+    // A stale reading is reported as null rather than the last distance.
+    if (isRangeReadingFresh())
+        appendResponseFormat(out, ",\"range\":{\"mm\":%u", (unsigned)filteredMm);
+    else
+        appendResponse(out, ",\"range\":{\"mm\":null");
+
+    appendResponseFormat(out, ",\"echoes\":%lu,\"timeouts\":%lu}",
+                         (unsigned long)echoCount, (unsigned long)timeoutCount);
+}
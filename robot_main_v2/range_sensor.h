@@ -0,0 +1,15 @@
+#ifndef RANGE_SENSOR_H
+#define RANGE_SENSOR_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+void initRangeSensor();
+void updateRangeSensor();
+bool isRangeReadingFresh();
+uint16_t getRangeDistanceMm();
+unsigned long getRangeSampleMs();
+void appendRangeStatus(ResponseWriter &out);
+
+#endif
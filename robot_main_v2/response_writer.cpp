@@ -0,0 +1,102 @@
+#include <esp_heap_caps.h>
+#include <stdarg.h>
+
+#include "response_writer.h"
+
+void beginResponse(ResponseWriter &out, char *buffer, size_t capacity)
+{
+    out.buffer = buffer;
+    out.capacity = capacity;
+    out.length = 0;
+    out.truncated = false;
+
+    if (capacity > 0)
+        buffer[0] = '\0';
+}
+
+void appendResponse(ResponseWriter &out, const char *text)
+{
+    while (*text != '\0')
+    {
+        if (out.length + 1 >= out.capacity)
+        {
+            out.truncated = true;
+            return;
+        }
+        out.buffer[out.length++] = *text++;
+    }
+    out.buffer[out.length] = '\0';
+}
+
+void appendResponseFormat(ResponseWriter &out, const char *format, ...)
+{
+    if (out.length + 1 >= out.capacity)
+    {
+        out.truncated = true;
+        return;
+    }
+
+    // Integer conversions only: newlib's float path allocates on first use.
+    va_list args;
+    va_start(args, format);
+    size_t room = out.capacity - out.length;
+    int written = vsnprintf(out.buffer + out.length, room, format, args);
+    va_end(args);
+
+    if (written < 0)
+    {
+        out.buffer[out.length] = '\0';
+        out.truncated = true;
+        return;
+    }
+
+    if ((size_t)written >= room)
+    {
+        out.length = out.capacity - 1;
+        out.truncated = true;
+        return;
+    }
+
+    out.length += written;
+}
+
+void appendJsonString(ResponseWriter &out, const char *text)
+{
+    char escaped[3] = {'\\', '\0', '\0'};
+    char plain[2] = {'\0', '\0'};
+
+    appendResponse(out, "\"");
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+        {
+            escaped[1] = *text;
+            appendResponse(out, escaped);
+        }
+        else if ((uint8_t)*text < 0x20)
+        {
+            appendResponseFormat(out, "\\u%04x", (uint8_t)*text);
+        }
+        else
+        {
+            plain[0] = *text;
+            appendResponse(out, plain);
+        }
+    }
+    appendResponse(out, "\"");
+}
+
+void appendJsonIp(ResponseWriter &out, uint32_t ip)
+{
+    // lwIP keeps addresses in network order, so the first octet is the low byte.
+    appendResponseFormat(out, "\"%u.%u.%u.%u\"",
+                         (unsigned)(ip & 0xFF), (unsigned)((ip >> 8) & 0xFF),
+                         (unsigned)((ip >> 16) & 0xFF), (unsigned)(ip >> 24));
+}
+
+size_t countAllocatedHeapBlocks()
+{
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_DEFAULT);
+    return info.allocated_blocks;
+}
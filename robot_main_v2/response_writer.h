@@ -0,0 +1,26 @@
+#ifndef RESPONSE_WRITER_H
+#define RESPONSE_WRITER_H
+
+#include <Arduino.h>
+
+// Fixed-capacity text builder for HTTP replies. Writes into a caller-owned
+// buffer and never allocates; output past the capacity is dropped and
+// flagged as truncated.
+struct ResponseWriter
+{
+    char *buffer;
+    size_t capacity;
+    size_t length;
+    bool truncated;
+};
+
+void beginResponse(ResponseWriter &out, char *buffer, size_t capacity);
+void appendResponse(ResponseWriter &out, const char *text);
+void appendResponseFormat(ResponseWriter &out, const char *format, ...) __attribute__((format(printf, 2, 3)));
+void appendJsonString(ResponseWriter &out, const char *text);
+void appendJsonIp(ResponseWriter &out, uint32_t ip);
+
+// Heap blocks currently allocated, for checking a handler leaves none behind.
+size_t countAllocatedHeapBlocks();
+
+#endif
@@ -0,0 +1,262 @@
+#include "robot_commands.h"
+#include "audio_clips.h"
+#include "audio_engine.h"
+#include "autonomous_drive.h"
+#include "motor_control.h"
+#include "servo_ioc_module.h"
+
+namespace
+{
+    const char *setCommand(RobotCommand &command, CommandKind kind, int a, int b, const char *reply)
+    {
+        command.kind = kind;
+        command.a = (int16_t)a;
+        command.b = (int16_t)b;
+        command.reply = reply;
+        return reply;
+    }
+
+    const char *resolveMotionCommand(const char *action, int speed, RobotCommand &command)
+    {
+        int safeSpeed = constrain(speed, 0, 255);
+        int arcSpeed = safeSpeed / 2;
+
+        if (strcmp(action, "forward") == 0)
+            return setCommand(command, COMMAND_DRIVE, safeSpeed, safeSpeed, "MOTION FORWARD");
+        if (strcmp(action, "backward") == 0)
+            return setCommand(command, COMMAND_DRIVE, -safeSpeed, -safeSpeed, "MOTION BACKWARD");
+        if (strcmp(action, "left") == 0)
+            return setCommand(command, COMMAND_DRIVE, -safeSpeed, safeSpeed, "MOTION LEFT");
+        if (strcmp(action, "right") == 0)
+            return setCommand(command, COMMAND_DRIVE, safeSpeed, -safeSpeed, "MOTION RIGHT");
+        if (strcmp(action, "forward_left") == 0)
+            return setCommand(command, COMMAND_DRIVE, arcSpeed, safeSpeed, "MOTION FORWARD_LEFT");
+        if (strcmp(action, "forward_right") == 0)
+            return setCommand(command, COMMAND_DRIVE, safeSpeed, arcSpeed, "MOTION FORWARD_RIGHT");
+        if (strcmp(action, "backward_left") == 0)
+            return setCommand(command, COMMAND_DRIVE, -arcSpeed, -safeSpeed, "MOTION BACKWARD_LEFT");
+        if (strcmp(action, "backward_right") == 0)
+            return setCommand(command, COMMAND_DRIVE, -safeSpeed, -arcSpeed, "MOTION BACKWARD_RIGHT");
+        if (strcmp(action, "stop") == 0)
+            return setCommand(command, COMMAND_STOP, 0, 0, "MOTION STOP");
+
+        return "UNKNOWN";
+    }
+
+    const char *resolveServoCommand(const char *target, const char *action, RobotCommand &command)
+    {
+        if (strcmp(target, "head") == 0)
+        {
+            if (strcmp(action, "left") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::HEAD_SERVO_ID, 0, "SERVO HEAD LEFT");
+            if (strcmp(action, "center") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::HEAD_SERVO_ID, 90, "SERVO HEAD CENTER");
+            if (strcmp(action, "right") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::HEAD_SERVO_ID, 180, "SERVO HEAD RIGHT");
+        }
+
+        if (strcmp(target, "left_arm") == 0)
+        {
+            if (strcmp(action, "up") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::LEFT_ARM_SERVO_ID, 120, "SERVO LEFT_ARM UP");
+            if (strcmp(action, "center") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::LEFT_ARM_SERVO_ID, 60, "SERVO LEFT_ARM CENTER");
+            if (strcmp(action, "down") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::LEFT_ARM_SERVO_ID, 0, "SERVO LEFT_ARM DOWN");
+        }
+
+        if (strcmp(target, "right_arm") == 0)
+        {
+            if (strcmp(action, "up") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::RIGHT_ARM_SERVO_ID, 120, "SERVO RIGHT_ARM UP");
+            if (strcmp(action, "center") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::RIGHT_ARM_SERVO_ID, 60, "SERVO RIGHT_ARM CENTER");
+            if (strcmp(action, "down") == 0)
+                return setCommand(command, COMMAND_SERVO, RobotConst::RIGHT_ARM_SERVO_ID, 0, "SERVO RIGHT_ARM DOWN");
+        }
+
+        return "UNKNOWN";
+    }
+
+    const char *resolveSystemCommand(const char *action, RobotCommand &command)
+    {
+        if (strcmp(action, "autonomous_on") == 0)
+            return setCommand(command, COMMAND_AUTONOMOUS, 1, 0, "SYSTEM AUTONOMOUS ON");
+        if (strcmp(action, "autonomous_off") == 0)
+            return setCommand(command, COMMAND_AUTONOMOUS, 0, 0, "SYSTEM AUTONOMOUS OFF");
+        if (strcmp(action, "pose_on") == 0)
+            return setCommand(command, COMMAND_POSE, 1, 0, "SYSTEM POSE ON");
+        if (strcmp(action, "pose_off") == 0)
+            return setCommand(command, COMMAND_POSE, 0, 0, "SYSTEM POSE OFF");
+
+        return "UNKNOWN";
+    }
+
+    const char *resolveSoundCommand(const char *action, RobotCommand &command)
+    {
+        int clipId = findAudioClip(action);
+        if (clipId < 0)
+            return "UNKNOWN";
+
+        return setCommand(command, COMMAND_SOUND, clipId, 0, AUDIO_CLIPS[clipId].reply);
+    }
+
+    bool isResolved(const char *reply)
+    {
+        return strcmp(reply, "UNKNOWN") != 0 && strcmp(reply, "SERVOS STARTING") != 0;
+    }
+
+    // Two entries for the same target would leave the outcome to entry
+    // order, so a batch names each target at most once. Sounds are mixed,
+    // not replaced, so several may start together.
+    bool isRepeatedTarget(const char targets[][16], int count, const char *target)
+    {
+        if (strcmp(target, "sound") == 0)
+            return false;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (strcmp(targets[i], target) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    // `target:action[:speed]` with nothing left over; target and action
+    // buffers are 16 and 24 bytes.
+    bool parseBatchEntry(const char *entry, char *target, char *action, int &speed)
+    {
+        int consumed = 0;
+        if (sscanf(entry, "%15[a-z_]:%23[a-z_]%n", target, action, &consumed) < 2)
+            return false;
+
+        if (entry[consumed] == ':')
+        {
+            const char *speedText = entry + consumed + 1;
+            int speedLen = 0;
+            if (!(isdigit((unsigned char)*speedText) || *speedText == '-') ||
+                sscanf(speedText, "%d%n", &speed, &speedLen) < 1)
+                return false;
+            consumed += 1 + speedLen;
+        }
+
+        return entry[consumed] == '\0';
+    }
+}
+
+const char *resolveCommand(const char *target, const char *action, int speed, RobotCommand &command)
+{
+    if (strcmp(target, "motion") == 0)
+        return resolveMotionCommand(action, speed, command);
+
+    if (strcmp(target, "head") == 0 || strcmp(target, "left_arm") == 0 || strcmp(target, "right_arm") == 0)
+        return isServoIOCReady() ? resolveServoCommand(target, action, command) : "SERVOS STARTING";
+
+    if (strcmp(target, "system") == 0)
+        return resolveSystemCommand(action, command);
+
+    if (strcmp(target, "sound") == 0)
+        return resolveSoundCommand(action, command);
+
+    return "UNKNOWN";
+}
+
+void applyCommand(const RobotCommand &command)
+{
+    switch (command.kind)
+    {
+    case COMMAND_DRIVE:
+        setAutonomousDriveEnabled(false);
+        driveTank(command.a, command.b);
+        break;
+    case COMMAND_STOP:
+        setAutonomousDriveEnabled(false);
+        stopMotors();
+        break;
+    case COMMAND_SERVO:
+        setServoAutoPoseEnabled(false);
+        setServoAngle((uint8_t)command.a, command.b);
+        break;
+    case COMMAND_AUTONOMOUS:
+        setAutonomousDriveEnabled(command.a != 0);
+        if (command.a == 0)
+            stopMotors();
+        break;
+    case COMMAND_POSE:
+        setServoAutoPoseEnabled(command.a != 0);
+        break;
+    case COMMAND_SOUND:
+        playSound((uint8_t)command.a);
+        break;
+    }
+}
+
+const char *mapAndApplyCommand(const char *target, const char *action, int speed)
+{
+    RobotCommand command;
+    const char *reply = resolveCommand(target, action, speed, command);
+    if (isResolved(reply))
+        applyCommand(command);
+    return reply;
+}
+
+const char *parseCommandBatch(const char *spec, int defaultSpeed, CommandBatch &batch)
+{
+    char targets[RobotConst::BATCH_MAX_COMMANDS][16];
+    batch.count = 0;
+    batch.failedEntry = 0;
+
+    while (*spec != '\0')
+    {
+        batch.failedEntry = batch.count + 1;
+
+        char entry[48];
+        size_t len = strcspn(spec, ",");
+        if (len == 0 || len >= sizeof(entry) || batch.count >= RobotConst::BATCH_MAX_COMMANDS)
+            return "BATCH INVALID";
+
+        memcpy(entry, spec, len);
+        entry[len] = '\0';
+
+        char *target = targets[batch.count];
+        char action[24];
+        int speed = defaultSpeed;
+        if (!parseBatchEntry(entry, target, action, speed) || isRepeatedTarget(targets, batch.count, target))
+            return "BATCH INVALID";
+
+        const char *reply = resolveCommand(target, action, speed, batch.commands[batch.count]);
+        if (!isResolved(reply))
+            return reply;
+
+        batch.count++;
+        spec += len;
+        if (*spec == ',' && *++spec == '\0')
+        {
+            // A trailing comma names an entry that is not there.
+            batch.failedEntry = batch.count + 1;
+            return "BATCH INVALID";
+        }
+    }
+
+    if (batch.count == 0)
+    {
+        batch.failedEntry = 1;
+        return "BATCH INVALID";
+    }
+
+    batch.failedEntry = 0;
+    return nullptr;
+}
+
+void applyCommandBatch(const CommandBatch &batch)
+{
+    for (int i = 0; i < batch.count; i++)
+        applyCommand(batch.commands[i]);
+}
+
+void appendCommandBatchReply(ResponseWriter &out, const CommandBatch &batch)
+{
+    appendResponseFormat(out, "BATCH %d:", batch.count);
+    for (int i = 0; i < batch.count; i++)
+        appendResponseFormat(out, i == 0 ? " %s" : ", %s", batch.commands[i].reply);
+}
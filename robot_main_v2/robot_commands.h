@@ -0,0 +1,60 @@
+#ifndef ROBOT_COMMANDS_H
+#define ROBOT_COMMANDS_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+#include "robot_constants.h"
+
+enum CommandKind : uint8_t
+{
+    COMMAND_DRIVE,
+    COMMAND_STOP,
+    COMMAND_SERVO,
+    COMMAND_AUTONOMOUS,
+    COMMAND_POSE,
+    COMMAND_SOUND
+};
+
+// DRIVE: a = left speed, b = right speed
+// SERVO: a = servo id, b = angle
+// AUTONOMOUS / POSE: a = 1 to enable, 0 to disable
+// SOUND: a = clip id
+struct RobotCommand
+{
+    CommandKind kind;
+    int16_t a;
+    int16_t b;
+    const char *reply;
+};
+
+struct CommandBatch
+{
+    RobotCommand commands[RobotConst::BATCH_MAX_COMMANDS];
+    int count;
+    int failedEntry;
+};
+
+// Resolves a web command without touching any actuator. Returns its static
+// reply text, "UNKNOWN", or "SERVOS STARTING" for a servo command while the
+// servo bank is still booting; only the first can be passed to applyCommand.
+const char *resolveCommand(const char *target, const char *action, int speed, RobotCommand &command);
+void applyCommand(const RobotCommand &command);
+
+// Resolves and applies in one step.
+const char *mapAndApplyCommand(const char *target, const char *action, int speed);
+
+// Parses "<target>:<action>[:<speed>]" entries separated by commas. Every
+// entry is resolved before anything is applied; on failure returns the
+// reply of the offending entry ("UNKNOWN", "SERVOS STARTING", or
+// "BATCH INVALID" for a malformed or repeated entry) with its 1-based index
+// in failedEntry, otherwise nullptr.
+const char *parseCommandBatch(const char *spec, int defaultSpeed, CommandBatch &batch);
+
+// Applies every command of a parsed batch back to back, in entry order.
+void applyCommandBatch(const CommandBatch &batch);
+
+// "BATCH <n>: <reply>, <reply>, ..." for an applied batch.
+void appendCommandBatchReply(ResponseWriter &out, const CommandBatch &batch);
+
+#endif
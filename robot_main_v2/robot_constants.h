@@ -1,6 +1,7 @@
 #ifndef ROBOT_CONSTANTS_H
 #define ROBOT_CONSTANTS_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace RobotConst
@@ -22,6 +23,22 @@ namespace RobotConst
     constexpr unsigned long DURATION_TURN_LEFT = 700;
     constexpr unsigned long DURATION_STOP = 700;
 
+    // ─── Obstacle reaction ────────────────────────────────────────
+    constexpr uint16_t RANGE_SLOW_MM = 600;
+    constexpr uint16_t RANGE_STOP_MM = 250;
+    constexpr uint16_t RANGE_CLEAR_MM = 450;
+    constexpr uint8_t CRAWL_SPEED = 110;
+    constexpr unsigned long AVOID_MIN_TURN_MS = 250;
+    constexpr unsigned long AVOID_MAX_TURN_MS = 2500;
+
+    // ─── Range sensor (HC-SR04) ───────────────────────────────────
+    constexpr unsigned long RANGE_PING_INTERVAL_MS = 40;
+    // The HC-SR04 holds echo high for ~38 ms when nothing answers; the
+    // timeout must outlast that pulse or its falling edge lands on the next ping.
+    constexpr unsigned long RANGE_ECHO_TIMEOUT_MS = 45;
+    constexpr unsigned long RANGE_STALE_MS = 200;
+    constexpr uint16_t RANGE_MAX_MM = 4000;
+
     // ─── Display palette/layout ───────────────────────────────────
     constexpr uint16_t BLACK = 0x0000;
     constexpr uint16_t WALLE_GREEN = 0x9E66;
@@ -48,12 +65,114 @@ namespace RobotConst
     constexpr unsigned long POSE_DELAY_MS = 1500;
     constexpr int HEAD_CENTER_ANGLE = 90;
 
+    // Servo IDs are 1-based across the bank: board b, channel c is
+    // b * SERVO_CONTROLLER_CHANNELS + c + 1.
     constexpr uint8_t LEFT_ARM_SERVO_ID = 1;
     constexpr uint8_t RIGHT_ARM_SERVO_ID = 2;
     constexpr uint8_t HEAD_SERVO_ID = 3;
     constexpr int SERVO_CONTROLLER_CHANNELS = 16;
     constexpr int ARM_ANGLE_MIN = 0;
     constexpr int ARM_ANGLE_MAX = 120;
+    constexpr unsigned long SERVO_RELEASE_AFTER_MS = 2000; // 0 keeps servos powered at rest
+    // A failed channel write is resent after SERVO_WRITE_BACKOFF_MS, doubling
+    // each time; after SERVO_WRITE_MAX_FAILURES in a row the channel is faulted.
+    constexpr unsigned long SERVO_WRITE_BACKOFF_MS = 20;
+    constexpr uint8_t SERVO_WRITE_MAX_FAILURES = 6;
+
+    // Chained PCA9685 boards, in bank order (address jumpers A0–A5 set 0x40–0x7F).
+    constexpr uint8_t PCA9685_ADDRESSES[] = {0x40};
+    constexpr int SERVO_BOARD_COUNT = sizeof(PCA9685_ADDRESSES) / sizeof(PCA9685_ADDRESSES[0]);
+    constexpr int SERVO_BANK_SIZE = SERVO_BOARD_COUNT * SERVO_CONTROLLER_CHANNELS;
+
+    // Pulse counts at 0° and 180°, and whether the horn turns the other way.
+    // Servos not listed use SERVOMIN/SERVOMAX, not inverted.
+    struct ServoCalibration
+    {
+        uint8_t servoId;
+        uint16_t minPulse;
+        uint16_t maxPulse;
+        bool inverted;
+    };
+
+    constexpr ServoCalibration SERVO_CALIBRATION[] = {
+        {LEFT_ARM_SERVO_ID, SERVOMIN, SERVOMAX, true},
+        {RIGHT_ARM_SERVO_ID, SERVOMIN, SERVOMAX, false},
+        {HEAD_SERVO_ID, SERVOMIN, SERVOMAX, false},
+    };
+
+    // ─── I2C transaction queue ────────────────────────────────────
+    constexpr uint32_t I2C_CLOCK_HZ = 400000;
+    constexpr uint16_t I2C_TIMEOUT_MS = 10;
+    constexpr int I2C_QUEUE_DEPTH = 32;
+    constexpr int I2C_MAX_RETRIES = 3;
+    constexpr int I2C_TASK_PRIORITY = 2;
+    constexpr int I2C_TASK_CORE = 1;
+
+    // ─── Web client sessions ──────────────────────────────────────
+    constexpr int MAX_CLIENT_SESSIONS = 4;
+    constexpr unsigned long SESSION_IDLE_MS = 30000;
+    constexpr unsigned long OWNER_TIMEOUT_MS = 5000;
+    constexpr int CMD_BURST = 5;
+    constexpr int CMD_RATE_PER_SEC = 20;
+    constexpr int BATCH_MAX_COMMANDS = 8;
+    constexpr size_t BATCH_SPEC_MAX_LEN = 384;
+
+    // ─── Power management ─────────────────────────────────────────
+    constexpr unsigned long NO_DEADLINE_MS = 0xFFFFFFFFUL;
+    constexpr unsigned long ACTIVE_TICK_MS = 10;
+    // WebServer is polled from loop(), so an HTTP request waits out the rest
+    // of the tick. Idle is the state whenever a client can reach the robot,
+    // which bounds that wait.
+    constexpr unsigned long IDLE_MAX_TICK_MS = 20;
+    constexpr unsigned long LOW_POWER_MAX_TICK_MS = 250;
+    constexpr unsigned long IDLE_AFTER_MS = 3000;
+    constexpr uint32_t ACTIVE_CPU_MHZ = 240;
+    constexpr uint32_t IDLE_CPU_MHZ = 80;
+
+    // ─── Multi-robot choreography ─────────────────────────────────
+    constexpr uint16_t SYNC_UDP_PORT = 4210;
+    constexpr int SYNC_QUEUE_DEPTH = 16;
+    constexpr int SYNC_HISTORY_DEPTH = 16;
+
+    // ─── Soft AP radio ────────────────────────────────────────────
+    // Channels 1–11 are legal everywhere; only the non-overlapping ones are
+    // candidates, a partial overlap hurts more than sharing a channel.
+    constexpr int AP_CHANNEL_MAX = 11;
+    constexpr uint8_t AP_CHANNEL_CANDIDATES[] = {1, 6, 11};
+    constexpr int AP_MAX_STATIONS = MAX_CLIENT_SESSIONS;
+    constexpr int AP_SCAN_MAX_RESULTS = 32;
+    constexpr uint32_t AP_SCAN_MS_PER_CHANNEL = 120;
+    constexpr int AP_STATION_TABLE_SIZE = 8;
+
+    // ─── Staged boot ──────────────────────────────────────────────
+    // Servo and display init run as background tasks while the loop task
+    // brings up the network; the Wi-Fi stack keeps priority on core 0.
+    constexpr uint32_t BOOT_TASK_STACK_SIZE = 4096;
+    constexpr int BOOT_TASK_PRIORITY = 1;
+    constexpr int BOOT_SERVO_CORE = 1;
+    constexpr int BOOT_DISPLAY_CORE = 0;
+
+    // ─── Timeline scheduler ───────────────────────────────────────
+    constexpr int TIMELINE_CAPACITY = 32;
+    constexpr size_t TIMELINE_SPEC_MAX_LEN = 768;
+
+    // ─── Teach and repeat ─────────────────────────────────────────
+    // 8 bytes per step; the whole routine is one NVS blob.
+    constexpr int TEACH_CAPACITY = 256;
+    constexpr int TEACH_RATE_MIN_PCT = 25;
+    constexpr int TEACH_RATE_MAX_PCT = 400;
+
+    // ─── Audio ────────────────────────────────────────────────────
+    // 16 kHz mono. One mix block fills one DMA buffer (16 ms), so the audio
+    // task always has a whole buffer of slack before the I2S output starves.
+    constexpr uint32_t AUDIO_SAMPLE_RATE = 16000;
+    constexpr int AUDIO_VOICES = 2;
+    constexpr int AUDIO_BLOCK_FRAMES = 256;
+    constexpr int AUDIO_DMA_BUFFERS = 2;
+    constexpr int AUDIO_TRIGGER_QUEUE_DEPTH = 4;
+    constexpr uint32_t AUDIO_TASK_STACK_SIZE = 4096;
+    constexpr int AUDIO_TASK_PRIORITY = 3;
+    constexpr int AUDIO_TASK_CORE = 1;
 }
 
 namespace RobotPins
@@ -77,6 +196,17 @@ namespace RobotPins
     // PCA9685 I2C reference: SDA = GPIO 21, SCL/SDL = GPIO 22
     constexpr uint8_t SERVO_I2C_SDA_PIN = 21;
     constexpr uint8_t SERVO_I2C_SCL_PIN = 22;
+
+    // ─── Range sensor pins ────────────────────────────────────────
+    // ECHO is a 5 V signal on HC-SR04: divide it down to 3.3 V
+    constexpr uint8_t RANGE_TRIG_PIN = 4;
+    constexpr uint8_t RANGE_ECHO_PIN = 35;
+
+    // ─── I2S audio pins ───────────────────────────────────────────
+    // MAX98357A-style I2S amplifier, mono
+    constexpr uint8_t I2S_BCLK_PIN = 19;
+    constexpr uint8_t I2S_LRCLK_PIN = 23;
+    constexpr uint8_t I2S_DOUT_PIN = 17;
 }
 
 #endif
\ No newline at end of file
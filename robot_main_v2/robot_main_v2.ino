@@ -10,8 +10,20 @@
  *   • motor_control.*
  *   • autonomous_drive.*
  *   • display_gauge.*
- *   • wifi_ap.*
+ *   • wifi_ap.* + channel_select.*
  *   • web_ui.*
+ *   • ota_update.*
+ *   • client_sessions.*
+ *   • power_manager.*
+ *   • i2c_queue.*
+ *   • range_sensor.*
+ *   • response_writer.*
+ *   • robot_commands.*
+ *   • sync_protocol.* + choreography.*
+ *   • timeline.*
+ *   • boot_stages.*
+ *   • audio_engine.* + audio_mixer.* + audio_clips.*
+ *   • teach_mode.*
  */
 
 #include <WiFi.h>
@@ -23,227 +35,562 @@
 #include "servo_ioc_module.h"
 #include "wifi_ap.h"
 #include "web_ui.h"
+#include "ota_update.h"
+#include "client_sessions.h"
+#include "power_manager.h"
+#include "i2c_queue.h"
+#include "range_sensor.h"
+#include "robot_commands.h"
+#include "choreography.h"
+#include "timeline.h"
+#include "boot_stages.h"
+#include "audio_engine.h"
+#include "audio_clips.h"
+#include "teach_mode.h"
+#include "response_writer.h"
+#include "robot_constants.h"
 
 namespace
 {
     constexpr uint16_t HTTP_PORT = 80;
     constexpr int DEFAULT_WEB_SPEED = 185;
+    constexpr unsigned long OTA_RESTART_DELAY_MS = 500;
+    constexpr size_t STATUS_BUFFER_SIZE = 2560;
 
     WebServer server(HTTP_PORT);
-    String lastCommand = "none";
+    const char *lastCommand = "none";
+    char statusBuffer[STATUS_BUFFER_SIZE];
 
-    String applyMotionCommand(const String &action, int speed)
+    uint32_t heapCheckedRequests = 0;
+    uint32_t heapLeakingRequests = 0;
+    int lastRequestNetBlocks = 0;
+
+    void holdActuatorsSafe()
+    {
+        clearTimeline();
+        cancelTeachReplay();
+        setAutonomousDriveEnabled(false);
+        stopMotors();
+        setServoAutoPoseEnabled(false);
+        holdServoPositions();
+    }
+
+    // Copies a query argument onto the stack; the temporary String that
+    // WebServer hands back is freed before the handler does any work.
+    // Returns false if the argument did not fit.
+    bool copyArg(const char *name, char *dest, size_t destSize)
     {
-        int safeSpeed = constrain(speed, 0, 255);
-        int arcSpeed = safeSpeed / 2;
+        return strlcpy(dest, server.arg(name).c_str(), destSize) < destSize;
+    }
+
+    int copyIntArg(const char *name, int defaultValue)
+    {
+        char text[12];
+        if (!copyArg(name, text, sizeof(text)) || text[0] == '\0')
+            return defaultValue;
+        return atoi(text);
+    }
+
+    // Leak check: compares the allocated block count at handler entry and
+    // just before the reply. The IDF heap keeps no allocation counter, so a
+    // block that is allocated and freed again inside the handler is not seen.
+    // WebServer's own parsing and header building are outside our control
+    // and not measured.
+    void recordRequestHeap(size_t blocksBefore)
+    {
+        lastRequestNetBlocks = (int)countAllocatedHeapBlocks() - (int)blocksBefore;
+        heapCheckedRequests++;
+        if (lastRequestNetBlocks != 0)
+            heapLeakingRequests++;
+    }
+
+    void sendReply(int code, const char *contentType, const char *text, size_t heapBlocksBefore)
+    {
+        recordRequestHeap(heapBlocksBefore);
+        server.send(code, contentType, text);
+    }
+
+    void sendText(int code, const char *text, size_t heapBlocksBefore)
+    {
+        sendReply(code, "text/plain", text, heapBlocksBefore);
+    }
+
+    void handleRoot()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        sendReply(200, "text/html", getPageHtml(), heapBlocksBefore);
+    }
 
-        if (action == "forward")
+    void handleCommand()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        if (isOtaUpdateActive())
+        {
+            sendText(503, "OTA IN PROGRESS", heapBlocksBefore);
+            return;
+        }
+
+        char target[sizeof(SessionCommand::target)];
+        char action[sizeof(SessionCommand::action)];
+        bool argsFit = copyArg("target", target, sizeof(target));
+        argsFit = copyArg("action", action, sizeof(action)) && argsFit;
+        int speed = copyIntArg("speed", DEFAULT_WEB_SPEED);
+
+        uint32_t clientIp = server.client().remoteIP();
+
+        // A truncated name could still match a real one, so it is refused
+        // outright, as /batch does with a spec that does not fit.
+        if (!argsFit)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(safeSpeed, safeSpeed);
-            return "MOTION FORWARD";
+            noteClientRequest(clientIp);
+            sendText(400, "UNKNOWN", heapBlocksBefore);
+            return;
         }
-        if (action == "backward")
+
+        if (strcmp(target, "system") == 0 && strcmp(action, "release_control") == 0)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(-safeSpeed, -safeSpeed);
-            return "MOTION BACKWARD";
+            noteClientRequest(clientIp);
+            releaseClientControl(clientIp);
+            sendText(200, "SYSTEM CONTROL RELEASED", heapBlocksBefore);
+            return;
         }
-        if (action == "left")
+
+        // A command that cannot run is refused before admission, so it
+        // neither claims control nor spends a token.
+        RobotCommand resolved;
+        const char *command = resolveCommand(target, action, speed, resolved);
+        if (strcmp(command, "UNKNOWN") == 0 || strcmp(command, "SERVOS STARTING") == 0)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(-safeSpeed, safeSpeed);
-            return "MOTION LEFT";
+            noteClientRequest(clientIp);
+            sendText(strcmp(command, "UNKNOWN") == 0 ? 400 : 503, command, heapBlocksBefore);
+            return;
         }
-        if (action == "right")
+
+        SessionAdmission admission = admitClientCommand(clientIp, target, action, speed);
+        if (admission == SESSION_READ_ONLY)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(safeSpeed, -safeSpeed);
-            return "MOTION RIGHT";
+            sendText(403, "READ ONLY", heapBlocksBefore);
+            return;
         }
-        if (action == "forward_left")
+        if (admission == SESSION_COALESCED)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(arcSpeed, safeSpeed);
-            return "MOTION FORWARD_LEFT";
+            sendText(202, "COALESCED", heapBlocksBefore);
+            return;
         }
-        if (action == "forward_right")
+
+        applyCommand(resolved);
+        noteManualCommand(resolved);
+        lastCommand = command;
+        notePowerActivity();
+        Serial.print("[WEB CMD] ");
+        Serial.println(command);
+        sendText(200, command, heapBlocksBefore);
+    }
+
+    // Every entry is resolved before any is applied, and all of them are
+    // applied within this handler, so the joints start in the same tick.
+    void handleBatch()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        if (isOtaUpdateActive())
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(safeSpeed, arcSpeed);
-            return "MOTION FORWARD_RIGHT";
+            sendText(503, "OTA IN PROGRESS", heapBlocksBefore);
+            return;
         }
-        if (action == "backward_left")
+
+        char spec[RobotConst::BATCH_SPEC_MAX_LEN];
+        bool specFits = copyArg("cmds", spec, sizeof(spec));
+
+        uint32_t clientIp = server.client().remoteIP();
+
+        char reply[256];
+        ResponseWriter out;
+        beginResponse(out, reply, sizeof(reply));
+
+        CommandBatch batch;
+        const char *failure = specFits ? parseCommandBatch(spec, DEFAULT_WEB_SPEED, batch) : "BATCH INVALID";
+        if (failure != nullptr)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(-arcSpeed, -safeSpeed);
-            return "MOTION BACKWARD_LEFT";
+            noteClientRequest(clientIp);
+            appendResponseFormat(out, "%s AT %d", failure, specFits ? batch.failedEntry : 0);
+            sendText(strcmp(failure, "SERVOS STARTING") == 0 ? 503 : 400, reply, heapBlocksBefore);
+            return;
         }
-        if (action == "backward_right")
+
+        SessionAdmission admission = admitClientBatch(clientIp);
+        if (admission == SESSION_READ_ONLY)
         {
-            setAutonomousDriveEnabled(false);
-            driveTank(-safeSpeed, -arcSpeed);
-            return "MOTION BACKWARD_RIGHT";
+            sendText(403, "READ ONLY", heapBlocksBefore);
+            return;
         }
-        if (action == "stop")
+        if (admission == SESSION_RATE_LIMITED)
         {
-            setAutonomousDriveEnabled(false);
-            stopMotors();
-            return "MOTION STOP";
+            sendText(429, "RATE LIMITED", heapBlocksBefore);
+            return;
         }
 
-        return "UNKNOWN";
+        applyCommandBatch(batch);
+        for (int i = 0; i < batch.count; i++)
+            noteManualCommand(batch.commands[i]);
+        appendCommandBatchReply(out, batch);
+
+        lastCommand = batch.commands[batch.count - 1].reply;
+        notePowerActivity();
+        Serial.print("[WEB CMD] ");
+        Serial.println(reply);
+        sendText(200, reply, heapBlocksBefore);
     }
 
-    String applyServoCommand(const String &target, const String &action)
+    void applyCoalescedCommand()
     {
-        if (target == "head")
+        SessionCommand pending;
+        if (!takeCoalescedCommand(pending))
+            return;
+
+        RobotCommand resolved;
+        const char *command = resolveCommand(pending.target, pending.action, pending.speed, resolved);
+        if (strcmp(command, "UNKNOWN") == 0 || strcmp(command, "SERVOS STARTING") == 0)
+            return;
+
+        applyCommand(resolved);
+        noteManualCommand(resolved);
+        lastCommand = command;
+        notePowerActivity();
+        Serial.print("[WEB CMD] ");
+        Serial.print(command);
+        Serial.println(" (coalesced)");
+    }
+
+    // Parsed before admission like /batch, so an invalid spec neither claims
+    // control nor spends a token.
+    void handleTimeline()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        if (isOtaUpdateActive())
         {
-            if (action == "left")
-            {
-                setServoAutoPoseEnabled(false);
-                setHeadServoAngle(0);
-                return "SERVO HEAD LEFT";
-            }
-            if (action == "center")
-            {
-                setServoAutoPoseEnabled(false);
-                setHeadServoAngle(90);
-                return "SERVO HEAD CENTER";
-            }
-            if (action == "right")
-            {
-                setServoAutoPoseEnabled(false);
-                setHeadServoAngle(180);
-                return "SERVO HEAD RIGHT";
-            }
+            sendText(503, "OTA IN PROGRESS", heapBlocksBefore);
+            return;
         }
 
-        if (target == "left_arm")
+        uint32_t clientIp = server.client().remoteIP();
+
+        if (server.hasArg("clear"))
         {
-            if (action == "up")
+            noteClientRequest(clientIp);
+            uint32_t ownerIp = getControllingClientIp();
+            if (ownerIp != 0 && ownerIp != clientIp)
             {
-                setServoAutoPoseEnabled(false);
-                setLeftArmServoAngle(120);
-                return "SERVO LEFT_ARM UP";
+                sendText(403, "READ ONLY", heapBlocksBefore);
+                return;
             }
-            if (action == "center")
+
+            clearTimeline();
+            sendText(200, "TIMELINE CLEARED", heapBlocksBefore);
+            return;
+        }
+
+        char spec[RobotConst::TIMELINE_SPEC_MAX_LEN];
+        TimelineEvent events[RobotConst::TIMELINE_CAPACITY];
+        int count = copyArg("events", spec, sizeof(spec)) ? parseTimelineSpec(spec, millis(), events) : -1;
+        if (count < 0)
+        {
+            noteClientRequest(clientIp);
+            sendText(400, "TIMELINE INVALID", heapBlocksBefore);
+            return;
+        }
+
+        SessionAdmission admission = admitClientBatch(clientIp);
+        if (admission == SESSION_READ_ONLY)
+        {
+            sendText(403, "READ ONLY", heapBlocksBefore);
+            return;
+        }
+        if (admission == SESSION_RATE_LIMITED)
+        {
+            sendText(429, "RATE LIMITED", heapBlocksBefore);
+            return;
+        }
+
+        if (!scheduleTimelineEvents(events, count))
+        {
+            sendText(400, "TIMELINE INVALID", heapBlocksBefore);
+            return;
+        }
+
+        char reply[32];
+        snprintf(reply, sizeof(reply), "TIMELINE QUEUED %d", count);
+        notePowerActivity();
+        sendText(200, reply, heapBlocksBefore);
+    }
+
+    void handleTeach()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        uint32_t clientIp = server.client().remoteIP();
+        noteClientRequest(clientIp);
+
+        uint32_t ownerIp = getControllingClientIp();
+        if (ownerIp != 0 && ownerIp != clientIp)
+        {
+            sendText(403, "READ ONLY", heapBlocksBefore);
+            return;
+        }
+
+        char action[16];
+        copyArg("action", action, sizeof(action));
+
+        if (strcmp(action, "record") == 0)
+        {
+            startTeachRecording();
+            sendText(200, "TEACH RECORDING", heapBlocksBefore);
+            return;
+        }
+
+        if (strcmp(action, "stop") == 0)
+        {
+            if (!isTeachRecording())
             {
-                setServoAutoPoseEnabled(false);
-                setLeftArmServoAngle(60);
-                return "SERVO LEFT_ARM CENTER";
+                sendText(409, "TEACH NOT RECORDING", heapBlocksBefore);
+                return;
             }
-            if (action == "down")
+            if (!stopTeachRecording())
             {
-                setServoAutoPoseEnabled(false);
-                setLeftArmServoAngle(0);
-                return "SERVO LEFT_ARM DOWN";
+                sendText(500, "TEACH NOT SAVED", heapBlocksBefore);
+                return;
             }
+            sendText(200, "TEACH SAVED", heapBlocksBefore);
+            return;
         }
 
-        if (target == "right_arm")
+        if (strcmp(action, "replay") == 0)
         {
-            if (action == "up")
-            {
-                setServoAutoPoseEnabled(false);
-                setRightArmServoAngle(120);
-                return "SERVO RIGHT_ARM UP";
-            }
-            if (action == "center")
+            int ratePercent = copyIntArg("rate", 100);
+            if (!startTeachReplay(ratePercent))
             {
-                setServoAutoPoseEnabled(false);
-                setRightArmServoAngle(60);
-                return "SERVO RIGHT_ARM CENTER";
+                sendText(409, "TEACH NOTHING TO REPLAY", heapBlocksBefore);
+                return;
             }
-            if (action == "down")
+            notePowerActivity();
+            sendText(200, "TEACH REPLAYING", heapBlocksBefore);
+            return;
+        }
+
+        if (strcmp(action, "cancel") == 0)
+        {
+            cancelTeachReplay();
+            sendText(200, "TEACH CANCELLED", heapBlocksBefore);
+            return;
+        }
+
+        if (strcmp(action, "clear") == 0)
+        {
+            if (!clearTeachRoutine())
             {
-                setServoAutoPoseEnabled(false);
-                setRightArmServoAngle(0);
-                return "SERVO RIGHT_ARM DOWN";
+                sendText(500, "TEACH NOT SAVED", heapBlocksBefore);
+                return;
             }
+            sendText(200, "TEACH CLEARED", heapBlocksBefore);
+            return;
         }
 
-        return "UNKNOWN";
+        sendText(400, "UNKNOWN", heapBlocksBefore);
     }
 
-    String applySystemCommand(const String &action)
+    void applyChoreographyCommands()
     {
-        if (action == "autonomous_on")
+        SyncProtocol::ScheduledCommand due;
+        while (takeDueChoreographyCommand(due))
         {
-            setAutonomousDriveEnabled(true);
-            return "SYSTEM AUTONOMOUS ON";
-        }
+            // UDP steps carry no client identity, so they only run while no
+            // web client holds control; otherwise any host on the network
+            // could take over the robot.
+            if (getControllingClientIp() != 0)
+            {
+                noteChoreographyStepBlocked();
+                continue;
+            }
 
-        if (action == "autonomous_off")
-        {
-            setAutonomousDriveEnabled(false);
-            stopMotors();
-            return "SYSTEM AUTONOMOUS OFF";
+            RobotCommand resolved;
+            const char *command = resolveCommand(due.target, due.action, due.speed, resolved);
+            if (strcmp(command, "UNKNOWN") == 0 || strcmp(command, "SERVOS STARTING") == 0)
+                continue;
+
+            applyCommand(resolved);
+            lastCommand = command;
+            notePowerActivity();
+            Serial.print("[SYNC CMD] ");
+            Serial.println(command);
         }
+    }
 
-        if (action == "pose_on")
+    const char *jsonBool(bool value)
+    {
+        return value ? "true" : "false";
+    }
+
+    void appendHeapStatus(ResponseWriter &out)
+    {
+        appendResponseFormat(out,
+                             ",\"heap\":{\"free\":%lu,\"min_free\":%lu,\"largest\":%lu,"
+                             "\"checked_requests\":%lu,\"leaking_requests\":%lu,\"last_request_net_blocks\":%d}",
+                             (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+                             (unsigned long)ESP.getMaxAllocHeap(), (unsigned long)heapCheckedRequests,
+                             (unsigned long)heapLeakingRequests, lastRequestNetBlocks);
+    }
+
+    void handleStatus()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        noteClientRequest(server.client().remoteIP());
+
+        ResponseWriter out;
+        beginResponse(out, statusBuffer, sizeof(statusBuffer));
+
+        appendResponse(out, "{\"last\":");
+        appendJsonString(out, lastCommand);
+        appendResponseFormat(out, ",\"modes\":{\"auto_drive\":%s,\"drive_degraded\":%s,\"auto_pose\":%s}",
+                             jsonBool(isAutonomousDriveEnabled()), jsonBool(isAutonomousDriveDegraded()),
+                             jsonBool(isServoAutoPoseEnabled()));
+        appendResponseFormat(out, ",\"motors\":{\"a\":%d,\"b\":%d}", getMotorASetpoint(), getMotorBSetpoint());
+        appendResponseFormat(out, ",\"servos\":{\"head\":%d,\"left_arm\":%d,\"right_arm\":%d,\"faulted\":%d}",
+                             getHeadServoAngle(), getLeftArmServoAngle(), getRightArmServoAngle(), countFaultedServos());
+        appendResponseFormat(out, ",\"charge\":{\"level\":%d,\"bars\":%d,\"rising\":%s}",
+                             getChargeLevel(), RobotConst::NUM_BARS, jsonBool(isChargeRising()));
+        appendSessionStatus(out);
+        appendWifiStatus(out);
+        appendPowerStatus(out);
+        appendI2cStatus(out);
+        appendRangeStatus(out);
+        appendChoreographyStatus(out);
+        appendTimelineStatus(out);
+        appendAudioStatus(out);
+        appendTeachStatus(out);
+        appendHeapStatus(out);
+        appendResponse(out, "}");
+
+        if (out.truncated)
         {
-            setServoAutoPoseEnabled(true);
-            return "SYSTEM POSE ON";
+            Serial.println("[ERROR] Status payload exceeds STATUS_BUFFER_SIZE");
+            sendText(500, "STATUS TRUNCATED", heapBlocksBefore);
+            return;
         }
 
-        if (action == "pose_off")
+        sendReply(200, "application/json", statusBuffer, heapBlocksBefore);
+    }
+
+    void handleBoot()
+    {
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
+        ResponseWriter out;
+        beginResponse(out, statusBuffer, sizeof(statusBuffer));
+        appendBootStatus(out);
+        sendReply(200, "application/json", statusBuffer, heapBlocksBefore);
+    }
+
+    void handleOtaUpload()
+    {
+        HTTPUpload &upload = server.upload();
+
+        switch (upload.status)
         {
-            setServoAutoPoseEnabled(false);
-            return "SYSTEM POSE OFF";
+        case UPLOAD_FILE_START:
+            holdActuatorsSafe();
+            beginOtaUpdate(server.hasArg("md5") ? server.arg("md5").c_str() : nullptr);
+            break;
+        case UPLOAD_FILE_WRITE:
+            writeOtaChunk(upload.buf, upload.currentSize);
+            break;
+        case UPLOAD_FILE_END:
+            finishOtaUpdate();
+            break;
+        case UPLOAD_FILE_ABORTED:
+            abortOtaUpdate();
+            break;
         }
-
-        return "UNKNOWN";
     }
 
-    String mapAndApplyCommand(const String &target, const String &action, int speed)
+    void handleOtaDone()
     {
-        if (target == "motion")
-            return applyMotionCommand(action, speed);
+        size_t heapBlocksBefore = countAllocatedHeapBlocks();
 
-        if (target == "head" || target == "left_arm" || target == "right_arm")
-            return applyServoCommand(target, action);
+        char report[192];
+        ResponseWriter out;
+        beginResponse(out, report, sizeof(report));
+        appendOtaReport(out);
+        bool succeeded = isOtaUpdateSucceeded();
 
-        if (target == "system")
-            return applySystemCommand(action);
+        sendText(succeeded ? 200 : 500, report, heapBlocksBefore);
 
-        return "UNKNOWN";
+        if (succeeded)
+        {
+            delay(OTA_RESTART_DELAY_MS);
+            ESP.restart();
+        }
     }
 
-    void handleRoot()
+    // ─── Boot stages (see boot_stages.h) ────────────────────────────
+    bool bootSafeActuators()
     {
-        server.send(200, "text/html", getPageHtml());
+        initOtaUpdate();
+        initMotors();
+        initRangeSensor();
+        initAutonomousDrive();
+        initClientSessions();
+        initTimeline();
+        initTeachMode();
+        return true;
     }
 
-    void handleCommand()
+    bool bootServos()
     {
-        String target = server.arg("target");
-        String action = server.arg("action");
-        int speed = server.hasArg("speed") ? server.arg("speed").toInt() : DEFAULT_WEB_SPEED;
+        initServoIOC();
+        return true;
+    }
 
-        String command = mapAndApplyCommand(target, action, speed);
+    bool bootDisplay()
+    {
+        initGaugeDisplay();
+        return true;
+    }
 
-        if (command == "UNKNOWN")
-        {
-            server.send(400, "text/plain", command);
-            return;
-        }
+    bool bootAudio()
+    {
+        if (!initAudio())
+            return false;
 
-        lastCommand = command;
-        Serial.print("[WEB CMD] ");
-        Serial.println(command);
-        server.send(200, "text/plain", command);
+        playSound((uint8_t)findAudioClip("boot"));
+        return true;
     }
 
-    void handleStatus()
+    bool bootNetwork()
     {
-        String status = "last=" + lastCommand;
-        status += " | auto_drive=";
-        status += isAutonomousDriveEnabled() ? "on" : "off";
-        status += " | auto_pose=";
-        status += isServoAutoPoseEnabled() ? "on" : "off";
+        if (!startRobotAccessPoint())
+            return false;
+
+        Serial.print("[INFO] AP started. SSID: ");
+        Serial.println(getRobotAccessPointSsid());
+        Serial.print("[INFO] AP IP: ");
+        Serial.println(WiFi.softAPIP());
+
+        initPowerManager();
+        initChoreography();
+        return true;
+    }
 
-        server.send(200, "text/plain", status);
+    bool bootHttp()
+    {
+        server.on("/", HTTP_GET, handleRoot);
+        server.on("/cmd", HTTP_GET, handleCommand);
+        server.on("/batch", HTTP_GET, handleBatch);
+        server.on("/status", HTTP_GET, handleStatus);
+        server.on("/timeline", HTTP_GET, handleTimeline);
+        server.on("/teach", HTTP_GET, handleTeach);
+        server.on("/boot", HTTP_GET, handleBoot);
+        server.on("/update", HTTP_POST, handleOtaDone, handleOtaUpload);
+        server.begin();
+
+        Serial.println("[INFO] HTTP server started");
+        return true;
     }
 }
 
@@ -256,29 +603,24 @@ void setup()
     Serial.begin(115200);
     Serial.println("== Robot Main v2 ==");
 
-    initMotors();
-    initGaugeDisplay();
-    initAutonomousDrive();
-    initServoIOC();
+    // Motors stopped before anything slow runs. Servos and display come up
+    // in the background while the AP scan and HTTP start here.
+    runBootStage(BOOT_SAFE, bootSafeActuators);
+    startBootStageTask(BOOT_SERVOS, bootServos, RobotConst::BOOT_SERVO_CORE);
+    startBootStageTask(BOOT_DISPLAY, bootDisplay, RobotConst::BOOT_DISPLAY_CORE);
 
-    if (!startRobotAccessPoint())
+    if (!runBootStage(BOOT_NETWORK, bootNetwork))
     {
         Serial.println("[ERROR] AP start failed. Rebooting in 5s.");
+        rollbackOtaBootIfPending();
         delay(5000);
         ESP.restart();
     }
 
-    Serial.print("[INFO] AP started. SSID: ");
-    Serial.println(getRobotAccessPointSsid());
-    Serial.print("[INFO] AP IP: ");
-    Serial.println(WiFi.softAPIP());
-
-    server.on("/", HTTP_GET, handleRoot);
-    server.on("/cmd", HTTP_GET, handleCommand);
-    server.on("/status", HTTP_GET, handleStatus);
-    server.begin();
+    runBootStage(BOOT_HTTP, bootHttp);
+    runBootStage(BOOT_AUDIO, bootAudio);
 
-    Serial.println("[INFO] HTTP server started");
+    confirmOtaBootHealthy();
 
     Serial.println("Ready.");
 }
@@ -290,8 +632,30 @@ void setup()
 void loop()
 {
     server.handleClient();
+
+    if (isOtaUpdateActive())
+        return;
+
+    applyChoreographyCommands();
+    applyCoalescedCommand();
+    updateTimeline();
+    updateTeachMode();
+    updateRangeSensor();
     updateAutonomousDrive();
     updateCharge();
     updateServoIOC();
-    delay(10);
+
+    // A timeline event far ahead only sets the wait below; the robot wakes
+    // up one active tick before it comes due.
+    bool timelineImminent = getTimelineDueInMs() <= RobotConst::ACTIVE_TICK_MS;
+    bool actuatorsBusy = isAutonomousDriveEnabled() || isServoAutoPoseEnabled() ||
+                         areMotorsRunning() || isServoMotionPending() || timelineImminent ||
+                         isTeachReplaying() || isAudioPlaying();
+    updatePowerManager(actuatorsBusy);
+
+    unsigned long nextDeadlineMs = min(getChargeUpdateDueInMs(), getServoUpdateDueInMs());
+    nextDeadlineMs = min(nextDeadlineMs, getChoreographyDueInMs());
+    nextDeadlineMs = min(nextDeadlineMs, getTimelineDueInMs());
+    nextDeadlineMs = min(nextDeadlineMs, getTeachDueInMs());
+    waitForNextTick(nextDeadlineMs);
 }
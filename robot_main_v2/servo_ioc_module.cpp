@@ -3,16 +3,37 @@
 #include <Adafruit_PWMServoDriver.h>
 
 #include "servo_ioc_module.h"
+#include "i2c_queue.h"
 #include "robot_constants.h"
 
 namespace
 {
-    Adafruit_PWMServoDriver pwm = Adafruit_PWMServoDriver();
+    constexpr int ACTIVE_MASK_WORDS = (RobotConst::SERVO_BANK_SIZE + 31) / 32;
+    static_assert(RobotConst::SERVO_BANK_SIZE <= 255, "servo IDs are uint8_t");
+
     bool autoPoseEnabled = false;
 
-    int currentAngleByChannel[RobotConst::SERVO_CONTROLLER_CHANNELS];
-    int targetAngleByChannel[RobotConst::SERVO_CONTROLLER_CHANNELS];
-    unsigned long lastStepMsByChannel[RobotConst::SERVO_CONTROLLER_CHANNELS];
+    // Indexed by bank channel (servo ID - 1), across all boards.
+    int currentAngleByChannel[RobotConst::SERVO_BANK_SIZE];
+    int targetAngleByChannel[RobotConst::SERVO_BANK_SIZE];
+    unsigned long lastStepMsByChannel[RobotConst::SERVO_BANK_SIZE];
+    bool releasedByChannel[RobotConst::SERVO_BANK_SIZE];
+    RobotConst::ServoCalibration calibrationByChannel[RobotConst::SERVO_BANK_SIZE];
+    volatile bool rewriteByChannel[RobotConst::SERVO_BANK_SIZE];
+    // Consecutive failed writes; a channel that reaches
+    // SERVO_WRITE_MAX_FAILURES is faulted and left alone until its next target.
+    volatile uint8_t failuresByChannel[RobotConst::SERVO_BANK_SIZE];
+    volatile unsigned long rewriteAtMsByChannel[RobotConst::SERVO_BANK_SIZE];
+    bool faultedByChannel[RobotConst::SERVO_BANK_SIZE];
+
+    // Channels that still need ticks: moving, waiting to be released, or
+    // owed a resend. Everything else costs nothing per tick. The I2C worker
+    // task sets bits too, so every access is atomic.
+    uint32_t activeMask[ACTIVE_MASK_WORDS];
+
+    // initServoIOC() runs on a boot task; until it finishes every entry
+    // point is a no-op and reads report "not written yet".
+    volatile bool servoReady = false;
 
     enum ServoPose
     {
@@ -35,7 +56,7 @@ namespace
 
     bool isValidServoId(uint8_t servoId)
     {
-        return servoId >= 1 && servoId <= RobotConst::SERVO_CONTROLLER_CHANNELS;
+        return servoId >= 1 && servoId <= RobotConst::SERVO_BANK_SIZE;
     }
 
     int readCurrentAngle(uint8_t servoId)
@@ -48,19 +69,106 @@ namespace
         return readCurrentAngle(RobotConst::HEAD_SERVO_ID) == RobotConst::HEAD_CENTER_ANGLE;
     }
 
+    constexpr uint16_t PCA9685_FULL_OFF = 4096;
+    constexpr uint8_t PCA9685_LED0_ON_L = 0x06;
+
+    void markActive(uint8_t channel)
+    {
+        __atomic_fetch_or(&activeMask[channel / 32], (uint32_t)1 << (channel % 32), __ATOMIC_RELAXED);
+    }
+
+    // Calls visit(channel) for every active channel, lowest first.
+    template <typename Visit>
+    void forEachActiveChannel(Visit visit)
+    {
+        for (int word = 0; word < ACTIVE_MASK_WORDS; word++)
+        {
+            uint32_t bits = __atomic_load_n(&activeMask[word], __ATOMIC_RELAXED);
+            while (bits != 0)
+            {
+                int bit = __builtin_ctz(bits);
+                bits &= bits - 1;
+                visit((uint8_t)(word * 32 + bit));
+            }
+        }
+    }
+
+    // A write that exhausted its retries leaves the servo short of where we
+    // think it is, so flag the channel for a resend. Resends back off
+    // exponentially, so a missing board or a stuck bus is not hammered.
+    void scheduleRewrite(uint8_t channel)
+    {
+        uint8_t failures = failuresByChannel[channel];
+        if (failures < 255)
+            failuresByChannel[channel] = ++failures;
+
+        int shift = min((int)failures - 1, 6);
+        rewriteAtMsByChannel[channel] = millis() + (RobotConst::SERVO_WRITE_BACKOFF_MS << shift);
+        rewriteByChannel[channel] = true;
+        markActive(channel);
+    }
+
+    void onChannelWriteDone(bool ok, void *context)
+    {
+        uint8_t channel = (uint8_t)(uintptr_t)context;
+        if (ok)
+            failuresByChannel[channel] = 0;
+        else
+            scheduleRewrite(channel);
+    }
+
+    void writeChannelPwm(uint8_t channel, uint16_t off)
+    {
+        uint8_t data[4] = {0, 0, (uint8_t)(off & 0xFF), (uint8_t)(off >> 8)};
+        uint8_t address = RobotConst::PCA9685_ADDRESSES[channel / RobotConst::SERVO_CONTROLLER_CHANNELS];
+        uint8_t reg = PCA9685_LED0_ON_L + 4 * (channel % RobotConst::SERVO_CONTROLLER_CHANNELS);
+
+        if (!enqueueI2cWrite(address, reg, data, sizeof(data), onChannelWriteDone, (void *)(uintptr_t)channel))
+            scheduleRewrite(channel);
+    }
+
+    int angleToPulse(uint8_t channel, int angle)
+    {
+        const RobotConst::ServoCalibration &calibration = calibrationByChannel[channel];
+        int physical = calibration.inverted ? 180 - angle : angle;
+        return map(physical, 0, 180, calibration.minPulse, calibration.maxPulse);
+    }
+
+    void loadCalibration()
+    {
+        for (int i = 0; i < RobotConst::SERVO_BANK_SIZE; i++)
+            calibrationByChannel[i] = {(uint8_t)(i + 1), RobotConst::SERVOMIN, RobotConst::SERVOMAX, false};
+
+        for (const RobotConst::ServoCalibration &calibration : RobotConst::SERVO_CALIBRATION)
+        {
+            if (isValidServoId(calibration.servoId))
+                calibrationByChannel[toChannel(calibration.servoId)] = calibration;
+        }
+    }
+
+    void releaseChannel(uint8_t channel)
+    {
+        writeChannelPwm(channel, PCA9685_FULL_OFF);
+        releasedByChannel[channel] = true;
+    }
+
     void writeServoAngleImmediate(uint8_t servoId, int angle)
     {
         uint8_t channel = toChannel(servoId);
         int safeAngle = constrain(angle, 0, 180);
-        int pulse = map(safeAngle, 0, 180, RobotConst::SERVOMIN, RobotConst::SERVOMAX);
-        pwm.setPWM(channel, 0, pulse);
+        writeChannelPwm(channel, angleToPulse(channel, safeAngle));
         currentAngleByChannel[channel] = safeAngle;
         targetAngleByChannel[channel] = safeAngle;
         lastStepMsByChannel[channel] = millis();
+        releasedByChannel[channel] = false;
+        markActive(channel);
     }
 
     bool setServoTargetById(uint8_t servoId, int angle)
     {
+        if (!servoReady)
+            return false;
+
         if (!isValidServoId(servoId))
         {
             Serial.print("[ERROR] Invalid servo ID: ");
@@ -72,14 +180,30 @@ namespace
         uint8_t channel = toChannel(servoId);
         targetAngleByChannel[channel] = safeAngle;
 
+        // A new target gives a faulted channel another try.
+        if (faultedByChannel[channel])
+        {
+            faultedByChannel[channel] = false;
+            failuresByChannel[channel] = 0;
+        }
+
         if (currentAngleByChannel[channel] < 0)
         {
             writeServoAngleImmediate(servoId, safeAngle);
         }
 
+        markActive(channel);
         return true;
     }
 
+    // Arms stay within ARM_ANGLE_MIN..ARM_ANGLE_MAX whichever path sets them.
+    int limitServoAngle(uint8_t servoId, int angle)
+    {
+        if (servoId == RobotConst::LEFT_ARM_SERVO_ID || servoId == RobotConst::RIGHT_ARM_SERVO_ID)
+            return constrain(angle, RobotConst::ARM_ANGLE_MIN, RobotConst::ARM_ANGLE_MAX);
+        return angle;
+    }
+
     void setHeadTarget(int angle)
     {
         setServoTargetById(RobotConst::HEAD_SERVO_ID, angle);
@@ -87,15 +211,12 @@ namespace
 
     void setLeftArmTarget(int angle)
     {
-        int safeArmAngle = constrain(angle, RobotConst::ARM_ANGLE_MIN, RobotConst::ARM_ANGLE_MAX);
-        int invertedAngle = 180 - safeArmAngle;
-        setServoTargetById(RobotConst::LEFT_ARM_SERVO_ID, invertedAngle);
+        setServoTargetById(RobotConst::LEFT_ARM_SERVO_ID, limitServoAngle(RobotConst::LEFT_ARM_SERVO_ID, angle));
     }
 
     void setRightArmTarget(int angle)
     {
-        int safeArmAngle = constrain(angle, RobotConst::ARM_ANGLE_MIN, RobotConst::ARM_ANGLE_MAX);
-        setServoTargetById(RobotConst::RIGHT_ARM_SERVO_ID, safeArmAngle);
+        setServoTargetById(RobotConst::RIGHT_ARM_SERVO_ID, limitServoAngle(RobotConst::RIGHT_ARM_SERVO_ID, angle));
     }
 
     void applyPose(ServoPose nextPose)
@@ -149,62 +270,136 @@ namespace
         }
     }
 
-    void updateOneServoStep(uint8_t servoId)
+    // Returns true while the channel still needs ticks.
+    bool updateOneServoStep(uint8_t channel)
     {
-        uint8_t channel = toChannel(servoId);
         int current = currentAngleByChannel[channel];
         int target = targetAngleByChannel[channel];
 
-        if (current < 0 || current == target)
-            return;
+        if (current < 0 || faultedByChannel[channel])
+            return false;
 
         unsigned long now = millis();
-        if (now - lastStepMsByChannel[channel] < RobotConst::SERVO_STEP_DELAY_MS)
-            return;
+
+        if (rewriteByChannel[channel])
+        {
+            if (failuresByChannel[channel] >= RobotConst::SERVO_WRITE_MAX_FAILURES)
+            {
+                rewriteByChannel[channel] = false;
+                faultedByChannel[channel] = true;
+                Serial.print("[ERROR] Servo write failed repeatedly, channel faulted: ");
+                Serial.println(channel + 1);
+                return false;
+            }
+
+            // Hold the step too: it would be another write to the same bus.
+            if ((long)(rewriteAtMsByChannel[channel] - now) > 0)
+                return true;
+
+            rewriteByChannel[channel] = false;
+            writeChannelPwm(channel, releasedByChannel[channel] ? PCA9685_FULL_OFF : angleToPulse(channel, current));
+        }
+        unsigned long sinceLastStep = now - lastStepMsByChannel[channel];
+
+        if (current == target)
+        {
+            if (RobotConst::SERVO_RELEASE_AFTER_MS == 0 || releasedByChannel[channel])
+                return false;
+
+            if (sinceLastStep >= RobotConst::SERVO_RELEASE_AFTER_MS)
+            {
+                releaseChannel(channel);
+                return false;
+            }
+            return true;
+        }
+
+        if (sinceLastStep < RobotConst::SERVO_STEP_DELAY_MS)
+            return true;
 
         int direction = (target > current) ? 1 : -1;
         int next = current + direction;
-        int pulse = map(next, 0, 180, RobotConst::SERVOMIN, RobotConst::SERVOMAX);
-        pwm.setPWM(channel, 0, pulse);
+        writeChannelPwm(channel, angleToPulse(channel, next));
         currentAngleByChannel[channel] = next;
         lastStepMsByChannel[channel] = now;
+        releasedByChannel[channel] = false;
+        return true;
     }
 
+    // Each word is claimed before its channels are stepped, so a resend
+    // flagged by the worker meanwhile lands in the mask for the next tick.
     void updateAllServos()
     {
-        updateOneServoStep(RobotConst::LEFT_ARM_SERVO_ID);
-        updateOneServoStep(RobotConst::RIGHT_ARM_SERVO_ID);
-        updateOneServoStep(RobotConst::HEAD_SERVO_ID);
+        for (int word = 0; word < ACTIVE_MASK_WORDS; word++)
+        {
+            uint32_t bits = __atomic_exchange_n(&activeMask[word], 0, __ATOMIC_RELAXED);
+            while (bits != 0)
+            {
+                int bit = __builtin_ctz(bits);
+                bits &= bits - 1;
+
+                uint8_t channel = (uint8_t)(word * 32 + bit);
+                if (updateOneServoStep(channel))
+                    markActive(channel);
+            }
+        }
     }
 }
 
 void initServoIOC()
 {
-    for (int i = 0; i < RobotConst::SERVO_CONTROLLER_CHANNELS; i++)
+    servoReady = false;
+    for (int i = 0; i < RobotConst::SERVO_BANK_SIZE; i++)
     {
         currentAngleByChannel[i] = -1;
         targetAngleByChannel[i] = -1;
         lastStepMsByChannel[i] = 0;
+        releasedByChannel[i] = false;
+        rewriteByChannel[i] = false;
+        failuresByChannel[i] = 0;
+        rewriteAtMsByChannel[i] = 0;
+        faultedByChannel[i] = false;
     }
+    for (int word = 0; word < ACTIVE_MASK_WORDS; word++)
+        activeMask[word] = 0;
+    loadCalibration();
 
     Wire.begin(RobotPins::SERVO_I2C_SDA_PIN, RobotPins::SERVO_I2C_SCL_PIN);
 
-    pwm.begin();
-    pwm.setPWMFreq(RobotConst::SERVO_FREQ);
+    // Controller setup stays blocking; from here on the I2C worker task owns
+    // the bus and every channel write goes through the queue.
+    for (uint8_t address : RobotConst::PCA9685_ADDRESSES)
+    {
+        Adafruit_PWMServoDriver board(address);
+        board.begin();
+        board.setPWMFreq(RobotConst::SERVO_FREQ);
+    }
+
+    if (!initI2cQueue())
+        Serial.println("[ERROR] I2C queue start failed");
 
     writeServoAngleImmediate(RobotConst::HEAD_SERVO_ID, RobotConst::HEAD_CENTER_ANGLE);
-    writeServoAngleImmediate(RobotConst::LEFT_ARM_SERVO_ID, 180 - 60);
+    writeServoAngleImmediate(RobotConst::LEFT_ARM_SERVO_ID, 60);
     writeServoAngleImmediate(RobotConst::RIGHT_ARM_SERVO_ID, 60);
 
     pose = POSE_CENTER;
     poseStartMs = millis();
     poseApplied = true;
+    servoReady = true;
 
     Serial.println("[INFO] Servo IOC module ready");
 }
 
+bool isServoIOCReady()
+{
+    return servoReady;
+}
+
 void updateServoIOC()
 {
+    if (!servoReady)
+        return;
+
     updateAllServos();
 
     if (!autoPoseEnabled)
@@ -258,3 +453,101 @@ void setRightArmServoAngle(int angle)
 {
     setRightArmTarget(angle);
 }
+
+int getHeadServoAngle()
+{
+    return getServoAngle(RobotConst::HEAD_SERVO_ID);
+}
+
+int getLeftArmServoAngle()
+{
+    return getServoAngle(RobotConst::LEFT_ARM_SERVO_ID);
+}
+
+int getRightArmServoAngle()
+{
+    return getServoAngle(RobotConst::RIGHT_ARM_SERVO_ID);
+}
+
+bool setServoAngle(uint8_t servoId, int angle)
+{
+    return setServoTargetById(servoId, limitServoAngle(servoId, angle));
+}
+
+int getServoAngle(uint8_t servoId)
+{
+    return servoReady && isValidServoId(servoId) ? readCurrentAngle(servoId) : -1;
+}
+
+void holdServoPositions()
+{
+    if (!servoReady)
+        return;
+
+    forEachActiveChannel([](uint8_t channel) {
+        if (currentAngleByChannel[channel] >= 0)
+            targetAngleByChannel[channel] = currentAngleByChannel[channel];
+    });
+}
+
+bool isServoMotionPending()
+{
+    if (!servoReady)
+        return false;
+
+    bool pending = false;
+    forEachActiveChannel([&pending](uint8_t channel) {
+        if (currentAngleByChannel[channel] >= 0 && currentAngleByChannel[channel] != targetAngleByChannel[channel])
+            pending = true;
+    });
+    return pending;
+}
+
+unsigned long getServoUpdateDueInMs()
+{
+    if (!servoReady)
+        return RobotConst::NO_DEADLINE_MS;
+
+    if (isServoMotionPending())
+        return RobotConst::SERVO_STEP_DELAY_MS;
+
+    unsigned long now = millis();
+    unsigned long due = RobotConst::NO_DEADLINE_MS;
+    forEachActiveChannel([now, &due](uint8_t channel) {
+        if (faultedByChannel[channel])
+            return;
+        if (rewriteByChannel[channel])
+        {
+            long wait = (long)(rewriteAtMsByChannel[channel] - now);
+            due = min(due, wait > 0 ? (unsigned long)wait : 0UL);
+            return;
+        }
+        if (RobotConst::SERVO_RELEASE_AFTER_MS == 0 || currentAngleByChannel[channel] < 0 || releasedByChannel[channel])
+            return;
+
+        unsigned long atRest = now - lastStepMsByChannel[channel];
+        unsigned long remaining = atRest >= RobotConst::SERVO_RELEASE_AFTER_MS ? 0 : RobotConst::SERVO_RELEASE_AFTER_MS - atRest;
+        due = min(due, remaining);
+    });
+
+    return due;
+}
+
+int countFaultedServos()
+{
+    int count = 0;
+    for (int i = 0; i < RobotConst::SERVO_BANK_SIZE; i++)
+    {
+        if (faultedByChannel[i])
+            count++;
+    }
+    return count;
+}
+
+int countActiveServos()
+{
+    int count = 0;
+    for (int word = 0; word < ACTIVE_MASK_WORDS; word++)
+        count += __builtin_popcount(__atomic_load_n(&activeMask[word], __ATOMIC_RELAXED));
+    return count;
+}
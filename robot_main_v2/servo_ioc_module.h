@@ -1,12 +1,30 @@
 #ifndef SERVO_IOC_MODULE_H
 #define SERVO_IOC_MODULE_H
 
+#include <stdint.h>
+
 void initServoIOC();
+bool isServoIOCReady();
 void updateServoIOC();
 void setServoAutoPoseEnabled(bool enabled);
 bool isServoAutoPoseEnabled();
 void setHeadServoAngle(int angle);
 void setLeftArmServoAngle(int angle);
 void setRightArmServoAngle(int angle);
+int getHeadServoAngle();
+int getLeftArmServoAngle();
+int getRightArmServoAngle();
+
+// Any servo in the bank by ID (1-based across boards). Angles are logical
+// degrees; calibration maps them to pulses.
+bool setServoAngle(uint8_t servoId, int angle);
+int getServoAngle(uint8_t servoId);
+int countActiveServos();
+// Channels whose writes kept failing; they are retried on their next target.
+int countFaultedServos();
+
+void holdServoPositions();
+bool isServoMotionPending();
+unsigned long getServoUpdateDueInMs();
 
 #endif
@@ -0,0 +1,361 @@
+#include <string.h>
+
+#include "robot_constants.h"
+#include "sync_protocol.h"
+
+using namespace SyncProtocol;
+
+namespace
+{
+    constexpr uint8_t MAGIC_0 = 'W';
+    constexpr uint8_t MAGIC_1 = 'E';
+    constexpr size_t HEADER_LEN = 8;
+
+    struct ExecutedCommand
+    {
+        uint32_t seq;
+        uint64_t scheduledAtUs;
+        uint64_t executedAtUs;
+    };
+
+    ScheduledCommand queue[RobotConst::SYNC_QUEUE_DEPTH];
+    int queueCount = 0;
+
+    ExecutedCommand history[RobotConst::SYNC_HISTORY_DEPTH];
+    int historyCount = 0;
+    int historyNext = 0;
+
+    SchedulerStats stats = {};
+
+    // ─── Little-endian field access ─────────────────────────────────
+    struct Writer
+    {
+        uint8_t *out;
+        size_t capacity;
+        size_t len;
+        bool overflow;
+    };
+
+    void putBytes(Writer &w, const void *data, size_t n)
+    {
+        if (w.len + n > w.capacity)
+        {
+            w.overflow = true;
+            return;
+        }
+        memcpy(w.out + w.len, data, n);
+        w.len += n;
+    }
+
+    void putUint(Writer &w, uint64_t value, size_t bytes)
+    {
+        uint8_t raw[8];
+        for (size_t i = 0; i < bytes; i++)
+            raw[i] = (uint8_t)(value >> (8 * i));
+        putBytes(w, raw, bytes);
+    }
+
+    void putText(Writer &w, const char *text, size_t fieldLen)
+    {
+        uint8_t raw[ACTION_LEN] = {};
+        memcpy(raw, text, strnlen(text, fieldLen - 1));
+        putBytes(w, raw, fieldLen);
+    }
+
+    uint64_t getUint(const uint8_t *data, size_t bytes)
+    {
+        uint64_t value = 0;
+        for (size_t i = 0; i < bytes; i++)
+            value |= (uint64_t)data[i] << (8 * i);
+        return value;
+    }
+
+    void getText(const uint8_t *data, char *dest, size_t fieldLen)
+    {
+        memcpy(dest, data, fieldLen);
+        dest[fieldLen - 1] = '\0';
+    }
+
+    size_t bodyLength(PacketType type)
+    {
+        switch (type)
+        {
+        case PACKET_PING:
+            return 8;
+        case PACKET_PONG:
+            return 24;
+        case PACKET_EXEC_AT:
+            return 8 + TARGET_LEN + ACTION_LEN + 2;
+        case PACKET_ACK:
+            return 9;
+        case PACKET_REPORT:
+            return 17;
+        case PACKET_REPORT_QUERY:
+        case PACKET_CANCEL:
+            return 0;
+        default:
+            return SIZE_MAX;
+        }
+    }
+
+    // ─── Scheduler ──────────────────────────────────────────────────
+    int findQueued(uint32_t seq)
+    {
+        for (int i = 0; i < queueCount; i++)
+        {
+            if (queue[i].seq == seq)
+                return i;
+        }
+        return -1;
+    }
+
+    const ExecutedCommand *findExecuted(uint32_t seq)
+    {
+        for (int i = 0; i < historyCount; i++)
+        {
+            if (history[i].seq == seq)
+                return &history[i];
+        }
+        return nullptr;
+    }
+
+    void recordExecuted(const ScheduledCommand &command, uint64_t nowUs)
+    {
+        history[historyNext] = {command.seq, command.atUs, nowUs};
+        historyNext = (historyNext + 1) % RobotConst::SYNC_HISTORY_DEPTH;
+        if (historyCount < RobotConst::SYNC_HISTORY_DEPTH)
+            historyCount++;
+
+        uint64_t lateness = nowUs > command.atUs ? nowUs - command.atUs : 0;
+        if (lateness > stats.maxLatenessUs)
+            stats.maxLatenessUs = lateness > UINT32_MAX ? UINT32_MAX : (uint32_t)lateness;
+        stats.executed++;
+    }
+
+    uint8_t scheduleCommand(const Packet &request, uint64_t nowUs)
+    {
+        if (findQueued(request.seq) >= 0 || findExecuted(request.seq) != nullptr)
+            return ACK_DUPLICATE;
+
+        if (queueCount >= RobotConst::SYNC_QUEUE_DEPTH)
+        {
+            stats.rejected++;
+            return ACK_QUEUE_FULL;
+        }
+
+        ScheduledCommand &command = queue[queueCount++];
+        command.seq = request.seq;
+        command.atUs = request.at;
+        memcpy(command.target, request.target, TARGET_LEN);
+        memcpy(command.action, request.action, ACTION_LEN);
+        command.speed = request.speed;
+        stats.received++;
+
+        // A late command still runs right away, so robots do not diverge.
+        if (request.at <= nowUs)
+        {
+            stats.late++;
+            return ACK_LATE;
+        }
+        return ACK_QUEUED;
+    }
+}
+
+namespace SyncProtocol
+{
+    size_t encodePacket(const Packet &packet, uint8_t *out, size_t capacity)
+    {
+        Writer w = {out, capacity, 0, false};
+        uint8_t header[4] = {MAGIC_0, MAGIC_1, VERSION, packet.type};
+        putBytes(w, header, sizeof(header));
+        putUint(w, packet.seq, 4);
+
+        switch (packet.type)
+        {
+        case PACKET_PING:
+            putUint(w, packet.t0, 8);
+            break;
+        case PACKET_PONG:
+            putUint(w, packet.t0, 8);
+            putUint(w, packet.t1, 8);
+            putUint(w, packet.t2, 8);
+            break;
+        case PACKET_EXEC_AT:
+            putUint(w, packet.at, 8);
+            putText(w, packet.target, TARGET_LEN);
+            putText(w, packet.action, ACTION_LEN);
+            putUint(w, (uint16_t)packet.speed, 2);
+            break;
+        case PACKET_ACK:
+            putUint(w, packet.result, 1);
+            putUint(w, packet.t1, 8);
+            break;
+        case PACKET_REPORT:
+            putUint(w, packet.result, 1);
+            putUint(w, packet.at, 8);
+            putUint(w, packet.t1, 8);
+            break;
+        case PACKET_REPORT_QUERY:
+        case PACKET_CANCEL:
+            break;
+        default:
+            return 0;
+        }
+
+        return w.overflow ? 0 : w.len;
+    }
+
+    bool decodePacket(const uint8_t *data, size_t len, Packet &packet)
+    {
+        if (len < HEADER_LEN || data[0] != MAGIC_0 || data[1] != MAGIC_1 || data[2] != VERSION)
+            return false;
+
+        memset(&packet, 0, sizeof(packet));
+        packet.type = (PacketType)data[3];
+        packet.seq = (uint32_t)getUint(data + 4, 4);
+
+        size_t expected = bodyLength(packet.type);
+        if (expected == SIZE_MAX || len != HEADER_LEN + expected)
+            return false;
+
+        const uint8_t *body = data + HEADER_LEN;
+        switch (packet.type)
+        {
+        case PACKET_PING:
+            packet.t0 = getUint(body, 8);
+            break;
+        case PACKET_PONG:
+            packet.t0 = getUint(body, 8);
+            packet.t1 = getUint(body + 8, 8);
+            packet.t2 = getUint(body + 16, 8);
+            break;
+        case PACKET_EXEC_AT:
+            packet.at = getUint(body, 8);
+            getText(body + 8, packet.target, TARGET_LEN);
+            getText(body + 8 + TARGET_LEN, packet.action, ACTION_LEN);
+            packet.speed = (int16_t)getUint(body + 8 + TARGET_LEN + ACTION_LEN, 2);
+            break;
+        case PACKET_ACK:
+            packet.result = body[0];
+            packet.t1 = getUint(body + 1, 8);
+            break;
+        case PACKET_REPORT:
+            packet.result = body[0];
+            packet.at = getUint(body + 1, 8);
+            packet.t1 = getUint(body + 9, 8);
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+
+    void computeClockSample(const Packet &pong, uint64_t t3, int64_t &offsetUs, int64_t &delayUs)
+    {
+        int64_t outbound = (int64_t)(pong.t1 - pong.t0);
+        int64_t inbound = (int64_t)(pong.t2 - t3);
+        offsetUs = (outbound + inbound) / 2;
+        delayUs = (int64_t)(t3 - pong.t0) - (int64_t)(pong.t2 - pong.t1);
+    }
+
+    void resetScheduler()
+    {
+        queueCount = 0;
+        historyCount = 0;
+        historyNext = 0;
+        stats = SchedulerStats();
+    }
+
+    size_t handleRobotPacket(const uint8_t *data, size_t len, uint64_t rxUs, ClockFn now,
+                             uint8_t *out, size_t capacity)
+    {
+        Packet request;
+        if (!decodePacket(data, len, request))
+            return 0;
+
+        Packet reply;
+        memset(&reply, 0, sizeof(reply));
+        reply.seq = request.seq;
+
+        switch (request.type)
+        {
+        case PACKET_PING:
+            reply.type = PACKET_PONG;
+            reply.t0 = request.t0;
+            reply.t1 = rxUs;
+            reply.t2 = now();
+            break;
+        case PACKET_EXEC_AT:
+            reply.type = PACKET_ACK;
+            reply.result = scheduleCommand(request, now());
+            reply.t1 = now();
+            break;
+        case PACKET_REPORT_QUERY:
+        {
+            reply.type = PACKET_REPORT;
+            int queued = findQueued(request.seq);
+            const ExecutedCommand *executed = findExecuted(request.seq);
+            if (queued >= 0)
+            {
+                reply.result = REPORT_PENDING;
+                reply.at = queue[queued].atUs;
+            }
+            else if (executed != nullptr)
+            {
+                reply.result = REPORT_EXECUTED;
+                reply.at = executed->scheduledAtUs;
+                reply.t1 = executed->executedAtUs;
+            }
+            else
+            {
+                reply.result = REPORT_UNKNOWN;
+            }
+            break;
+        }
+        case PACKET_CANCEL:
+            queueCount = 0;
+            reply.type = PACKET_ACK;
+            reply.result = ACK_CANCELLED;
+            reply.t1 = now();
+            break;
+        default:
+            return 0;
+        }
+
+        return encodePacket(reply, out, capacity);
+    }
+
+    bool takeDueCommand(uint64_t nowUs, ScheduledCommand &command)
+    {
+        int earliest = -1;
+        for (int i = 0; i < queueCount; i++)
+        {
+            if (earliest < 0 || queue[i].atUs < queue[earliest].atUs)
+                earliest = i;
+        }
+
+        if (earliest < 0 || queue[earliest].atUs > nowUs)
+            return false;
+
+        command = queue[earliest];
+        queue[earliest] = queue[--queueCount];
+        recordExecuted(command, nowUs);
+        return true;
+    }
+
+    uint64_t getNextCommandUs()
+    {
+        uint64_t next = UINT64_MAX;
+        for (int i = 0; i < queueCount; i++)
+        {
+            if (queue[i].atUs < next)
+                next = queue[i].atUs;
+        }
+        return next;
+    }
+
+    const SchedulerStats &getSchedulerStats()
+    {
+        return stats;
+    }
+}
@@ -0,0 +1,116 @@
+#ifndef SYNC_PROTOCOL_H
+#define SYNC_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Multi-robot choreography wire format and the robot-side scheduler. Plain
+// C++ with no Arduino dependencies, so the host coordinator and robot nodes
+// compile the same code. All fields are little-endian.
+//
+//   header   : 'W' 'E' version type seq:u32                    (8 bytes)
+//   PING     : t0:u64 (coordinator clock)
+//   PONG     : t0:u64 t1:u64 (robot rx) t2:u64 (robot tx)
+//   EXEC_AT  : at:u64 (robot clock) target[16] action[24] speed:i16
+//   ACK      : result:u8 robotNow:u64
+//   REPORT_Q : -
+//   REPORT   : state:u8 scheduledAt:u64 executedAt:u64
+//   CANCEL   : -            (answered with ACK)
+//
+// The coordinator estimates each robot's clock offset from PING/PONG and
+// sends EXEC_AT already converted to that robot's clock, so robots only need
+// a monotonic microsecond counter.
+
+namespace SyncProtocol
+{
+    constexpr uint8_t VERSION = 1;
+    constexpr size_t MAX_PACKET = 64;
+    constexpr size_t TARGET_LEN = 16;
+    constexpr size_t ACTION_LEN = 24;
+
+    enum PacketType : uint8_t
+    {
+        PACKET_PING = 1,
+        PACKET_PONG = 2,
+        PACKET_EXEC_AT = 3,
+        PACKET_ACK = 4,
+        PACKET_REPORT_QUERY = 5,
+        PACKET_REPORT = 6,
+        PACKET_CANCEL = 7
+    };
+
+    enum AckResult : uint8_t
+    {
+        ACK_QUEUED = 0,
+        ACK_DUPLICATE = 1,
+        ACK_QUEUE_FULL = 2,
+        ACK_LATE = 3,
+        ACK_CANCELLED = 4
+    };
+
+    enum ReportState : uint8_t
+    {
+        REPORT_UNKNOWN = 0,
+        REPORT_PENDING = 1,
+        REPORT_EXECUTED = 2
+    };
+
+    struct Packet
+    {
+        PacketType type;
+        uint32_t seq;
+        uint64_t t0;
+        uint64_t t1;
+        uint64_t t2;
+        uint64_t at;
+        char target[TARGET_LEN];
+        char action[ACTION_LEN];
+        int16_t speed;
+        uint8_t result;
+    };
+
+    struct ScheduledCommand
+    {
+        uint32_t seq;
+        uint64_t atUs;
+        char target[TARGET_LEN];
+        char action[ACTION_LEN];
+        int16_t speed;
+    };
+
+    struct SchedulerStats
+    {
+        uint32_t received;
+        uint32_t executed;
+        uint32_t late;
+        uint32_t rejected;
+        uint32_t maxLatenessUs;
+    };
+
+    size_t encodePacket(const Packet &packet, uint8_t *out, size_t capacity);
+    bool decodePacket(const uint8_t *data, size_t len, Packet &packet);
+
+    // NTP-style estimate from one exchange: offset is robot minus
+    // coordinator clock, delay is the round trip without robot processing.
+    void computeClockSample(const Packet &pong, uint64_t t3, int64_t &offsetUs, int64_t &delayUs);
+
+    // ─── Robot side ─────────────────────────────────────────────────
+    typedef uint64_t (*ClockFn)();
+
+    void resetScheduler();
+
+    // Handles one datagram received at rxUs and writes the reply into out.
+    // Returns the reply length, or 0 if nothing should be sent.
+    size_t handleRobotPacket(const uint8_t *data, size_t len, uint64_t rxUs, ClockFn now,
+                             uint8_t *out, size_t capacity);
+
+    // Pops the earliest command due at nowUs and records its execution time.
+    bool takeDueCommand(uint64_t nowUs, ScheduledCommand &command);
+
+    // Robot time of the next queued command, or UINT64_MAX when idle.
+    uint64_t getNextCommandUs();
+
+    const SchedulerStats &getSchedulerStats();
+}
+
+#endif
@@ -0,0 +1,290 @@
+#include <Preferences.h>
+
+#include "teach_mode.h"
+#include "motor_control.h"
+#include "robot_constants.h"
+
+namespace
+{
+    constexpr const char *NVS_NAMESPACE = "teach";
+    constexpr const char *NVS_STEPS_KEY = "steps";
+    constexpr const char *NVS_VERSION_KEY = "version";
+    constexpr uint8_t FORMAT_VERSION = 1;
+    constexpr unsigned long MAX_DELTA_MS = 0xFFFF;
+
+    // Pauses longer than MAX_DELTA_MS are shortened to it.
+    struct TeachStep
+    {
+        uint16_t deltaMs;
+        CommandKind kind;
+        uint8_t reserved;
+        int16_t a;
+        int16_t b;
+    };
+    static_assert(sizeof(TeachStep) == 8, "TeachStep is stored as a flash blob");
+
+    enum TeachState : uint8_t
+    {
+        TEACH_IDLE,
+        TEACH_RECORDING,
+        TEACH_REPLAYING
+    };
+
+    TeachStep steps[RobotConst::TEACH_CAPACITY];
+    int stepCount = 0;
+    TeachState state = TEACH_IDLE;
+    bool saved = false;
+    bool savePending = false;
+
+    unsigned long lastRecordedMs = 0;
+
+    int replayIndex = 0;
+    int replayRatePct = 100;
+    unsigned long replayDueMs = 0;
+    uint32_t replayCount = 0;
+    unsigned long maxLateMs = 0;
+
+    const char *stateName()
+    {
+        switch (state)
+        {
+        case TEACH_RECORDING:
+            return "recording";
+        case TEACH_REPLAYING:
+            return "replaying";
+        case TEACH_IDLE:
+        default:
+            return "idle";
+        }
+    }
+
+    bool isRecordedKind(CommandKind kind)
+    {
+        return kind == COMMAND_DRIVE || kind == COMMAND_STOP || kind == COMMAND_SERVO || kind == COMMAND_SOUND;
+    }
+
+    unsigned long scaledDelayMs(const TeachStep &step)
+    {
+        return (unsigned long)step.deltaMs * 100 / (unsigned long)replayRatePct;
+    }
+
+    unsigned long recordedDurationMs()
+    {
+        unsigned long total = 0;
+        for (int i = 0; i < stepCount; i++)
+            total += steps[i].deltaMs;
+        return total;
+    }
+
+    bool saveRoutine()
+    {
+        Preferences prefs;
+        if (!prefs.begin(NVS_NAMESPACE, false))
+            return false;
+
+        size_t bytes = (size_t)stepCount * sizeof(TeachStep);
+        bool ok = prefs.putUChar(NVS_VERSION_KEY, FORMAT_VERSION) == 1;
+        if (bytes == 0)
+            prefs.remove(NVS_STEPS_KEY);
+        else
+            ok = ok && prefs.putBytes(NVS_STEPS_KEY, steps, bytes) == bytes;
+        prefs.end();
+        return ok;
+    }
+
+    void loadRoutine()
+    {
+        stepCount = 0;
+
+        Preferences prefs;
+        if (!prefs.begin(NVS_NAMESPACE, true))
+            return;
+
+        size_t bytes = prefs.getBytesLength(NVS_STEPS_KEY);
+        if (prefs.getUChar(NVS_VERSION_KEY, 0) == FORMAT_VERSION && bytes % sizeof(TeachStep) == 0 &&
+            bytes <= sizeof(steps))
+        {
+            stepCount = (int)(prefs.getBytes(NVS_STEPS_KEY, steps, bytes) / sizeof(TeachStep));
+        }
+        prefs.end();
+    }
+
+    void finishReplay()
+    {
+        state = TEACH_IDLE;
+        stopMotors();
+    }
+}
+
+void initTeachMode()
+{
+    state = TEACH_IDLE;
+    replayCount = 0;
+    maxLateMs = 0;
+    loadRoutine();
+    saved = stepCount > 0;
+
+    if (stepCount > 0)
+    {
+        Serial.print("[INFO] Teach routine loaded: ");
+        Serial.print(stepCount);
+        Serial.println(" steps");
+    }
+}
+
+bool startTeachRecording()
+{
+    if (state == TEACH_REPLAYING)
+        cancelTeachReplay();
+
+    stepCount = 0;
+    saved = false;
+    savePending = false;
+    lastRecordedMs = millis();
+    state = TEACH_RECORDING;
+    return true;
+}
+
+bool stopTeachRecording()
+{
+    if (state != TEACH_RECORDING)
+        return false;
+
+    state = TEACH_IDLE;
+    saved = saveRoutine();
+    if (!saved)
+        Serial.println("[ERROR] Teach routine could not be saved");
+    return saved;
+}
+
+bool startTeachReplay(int ratePercent)
+{
+    if (state == TEACH_RECORDING || stepCount == 0)
+        return false;
+
+    replayRatePct = constrain(ratePercent, RobotConst::TEACH_RATE_MIN_PCT, RobotConst::TEACH_RATE_MAX_PCT);
+    replayIndex = 0;
+    replayDueMs = millis() + scaledDelayMs(steps[0]);
+    replayCount++;
+    state = TEACH_REPLAYING;
+    return true;
+}
+
+void cancelTeachReplay()
+{
+    if (state == TEACH_REPLAYING)
+        finishReplay();
+}
+
+bool clearTeachRoutine()
+{
+    if (state == TEACH_REPLAYING)
+        cancelTeachReplay();
+
+    state = TEACH_IDLE;
+    stepCount = 0;
+    savePending = false;
+    saved = saveRoutine();
+    return saved;
+}
+
+// Runs inside the command handlers: a compare, millis() and one 8-byte store.
+void noteManualCommand(const RobotCommand &command)
+{
+    if (state == TEACH_REPLAYING)
+    {
+        // The operator takes over. Motors keep running only if this command
+        // drives them itself.
+        state = TEACH_IDLE;
+        if (command.kind != COMMAND_DRIVE && command.kind != COMMAND_STOP)
+            stopMotors();
+        return;
+    }
+
+    if (state != TEACH_RECORDING || !isRecordedKind(command.kind))
+        return;
+
+    unsigned long now = millis();
+    unsigned long deltaMs = stepCount == 0 ? 0 : now - lastRecordedMs;
+    lastRecordedMs = now;
+
+    TeachStep &step = steps[stepCount++];
+    step.deltaMs = (uint16_t)(deltaMs > MAX_DELTA_MS ? MAX_DELTA_MS : deltaMs);
+    step.kind = command.kind;
+    step.reserved = 0;
+    step.a = command.a;
+    step.b = command.b;
+
+    // The flash write is left to loop(), so a full buffer costs the
+    // command handler nothing extra.
+    if (stepCount >= RobotConst::TEACH_CAPACITY)
+    {
+        state = TEACH_IDLE;
+        savePending = true;
+    }
+}
+
+// Due times advance from the previous due time, not from when a step ran,
+// so a late tick does not shift the rest of the routine.
+void updateTeachMode()
+{
+    if (savePending)
+    {
+        savePending = false;
+        Serial.println("[INFO] Teach buffer full, recording stopped");
+        saved = saveRoutine();
+        if (!saved)
+            Serial.println("[ERROR] Teach routine could not be saved");
+    }
+
+    if (state != TEACH_REPLAYING)
+        return;
+
+    unsigned long now = millis();
+    while ((long)(replayDueMs - now) <= 0)
+    {
+        unsigned long lateMs = now - replayDueMs;
+        if (lateMs > maxLateMs)
+            maxLateMs = lateMs;
+
+        const TeachStep &step = steps[replayIndex];
+        applyCommand(RobotCommand{step.kind, step.a, step.b, "TEACH REPLAY"});
+
+        if (++replayIndex >= stepCount)
+        {
+            finishReplay();
+            return;
+        }
+        replayDueMs += scaledDelayMs(steps[replayIndex]);
+    }
+}
+
+unsigned long getTeachDueInMs()
+{
+    if (savePending)
+        return 0;
+    if (state != TEACH_REPLAYING)
+        return RobotConst::NO_DEADLINE_MS;
+
+    long remaining = (long)(replayDueMs - millis());
+    return remaining > 0 ? (unsigned long)remaining : 0;
+}
+
+bool isTeachRecording()
+{
+    return state == TEACH_RECORDING;
+}
+
+bool isTeachReplaying()
+{
+    return state == TEACH_REPLAYING;
+}
+
+void appendTeachStatus(ResponseWriter &out)
+{
+    appendResponseFormat(out,
+                         ",\"teach\":{\"state\":\"%s\",\"steps\":%d,\"capacity\":%d,\"duration_ms\":%lu,"
+                         "\"saved\":%s,\"replays\":%lu,\"rate_pct\":%d,\"max_late_ms\":%lu}",
+                         stateName(), stepCount, RobotConst::TEACH_CAPACITY, recordedDurationMs(),
+                         saved ? "true" : "false", (unsigned long)replayCount, replayRatePct, maxLateMs);
+}
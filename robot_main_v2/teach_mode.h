@@ -0,0 +1,40 @@
+#ifndef TEACH_MODE_H
+#define TEACH_MODE_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+#include "robot_commands.h"
+
+// Teach and repeat: manual motion, servo and sound commands are recorded with
+// the time since the previous one into a fixed buffer, saved to NVS when
+// recording stops, and replayed from loop() with the same spacing.
+
+void initTeachMode();
+
+bool startTeachRecording();
+
+// Saves the routine to flash; false if it could not be written.
+bool stopTeachRecording();
+
+// ratePercent scales playback speed: 200 replays twice as fast. Clamped to
+// TEACH_RATE_MIN_PCT..TEACH_RATE_MAX_PCT. False if nothing is recorded.
+bool startTeachReplay(int ratePercent);
+
+// Stops a replay and the motors with it.
+void cancelTeachReplay();
+
+bool clearTeachRoutine();
+
+// Called for every command applied from web control: recorded while
+// recording, and a manual command ends a replay.
+void noteManualCommand(const RobotCommand &command);
+
+// Runs the replay and saves a routine whose buffer filled while recording.
+void updateTeachMode();
+unsigned long getTeachDueInMs();
+bool isTeachRecording();
+bool isTeachReplaying();
+void appendTeachStatus(ResponseWriter &out);
+
+#endif
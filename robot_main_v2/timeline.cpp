@@ -0,0 +1,271 @@
+#include "timeline.h"
+#include "audio_clips.h"
+#include "audio_engine.h"
+#include "autonomous_drive.h"
+#include "display_gauge.h"
+#include "motor_control.h"
+#include "robot_constants.h"
+#include "servo_ioc_module.h"
+
+namespace
+{
+    struct HeapEntry
+    {
+        TimelineEvent event;
+        uint32_t order;
+    };
+
+    // Binary min-heap on (atMs, order): only the root is looked at per tick,
+    // so events queued far ahead cost nothing until they come due.
+    HeapEntry heap[RobotConst::TIMELINE_CAPACITY];
+    int heapSize = 0;
+    uint32_t nextOrder = 0;
+
+    uint32_t dispatchedCount = 0;
+    uint32_t rejectedCount = 0;
+    unsigned long maxLateMs = 0;
+
+    // Signed difference keeps ordering right across the millis() wrap.
+    bool isBefore(const HeapEntry &a, const HeapEntry &b)
+    {
+        long diff = (long)(a.event.atMs - b.event.atMs);
+        if (diff != 0)
+            return diff < 0;
+        return (int32_t)(a.order - b.order) < 0;
+    }
+
+    void siftUp(int index)
+    {
+        while (index > 0)
+        {
+            int parent = (index - 1) / 2;
+            if (!isBefore(heap[index], heap[parent]))
+                return;
+
+            HeapEntry swap = heap[index];
+            heap[index] = heap[parent];
+            heap[parent] = swap;
+            index = parent;
+        }
+    }
+
+    void siftDown(int index)
+    {
+        while (true)
+        {
+            int smallest = index;
+            int left = 2 * index + 1;
+            int right = left + 1;
+            if (left < heapSize && isBefore(heap[left], heap[smallest]))
+                smallest = left;
+            if (right < heapSize && isBefore(heap[right], heap[smallest]))
+                smallest = right;
+            if (smallest == index)
+                return;
+
+            HeapEntry swap = heap[index];
+            heap[index] = heap[smallest];
+            heap[smallest] = swap;
+            index = smallest;
+        }
+    }
+
+    TimelineEvent popEarliest()
+    {
+        TimelineEvent event = heap[0].event;
+        heap[0] = heap[--heapSize];
+        siftDown(0);
+        return event;
+    }
+
+    void dispatch(const TimelineEvent &event)
+    {
+        switch (event.action)
+        {
+        case TIMELINE_DRIVE:
+            setAutonomousDriveEnabled(false);
+            driveTank(event.a, event.b);
+            break;
+        case TIMELINE_SERVO:
+            setServoAutoPoseEnabled(false);
+            setServoAngle((uint8_t)event.a, event.b);
+            break;
+        case TIMELINE_GAUGE:
+            setGaugeHighlight(event.a != 0);
+            break;
+        case TIMELINE_SOUND:
+            playSound((uint8_t)event.a);
+            break;
+        }
+    }
+
+    // One "<offset_ms>:<kind>:<x>[:<y>]" entry. A gauge entry expands to an
+    // on event and an off event <x> ms later.
+    int parseSpecEntry(const char *entry, unsigned long baseMs, TimelineEvent *out)
+    {
+        char kind[16];
+        long offsetMs = 0;
+        long x = 0;
+        long y = 0;
+        int consumed = 0;
+        if (sscanf(entry, "%ld:%15[a-z_]:%ld%n", &offsetMs, kind, &x, &consumed) < 3 || offsetMs < 0)
+            return 0;
+
+        int fields = 3;
+        if (entry[consumed] == ':')
+        {
+            const char *yText = entry + consumed + 1;
+            int yLen = 0;
+            if (!(isdigit((unsigned char)*yText) || *yText == '-') || sscanf(yText, "%ld%n", &y, &yLen) < 1)
+                return 0;
+            consumed += 1 + yLen;
+            fields = 4;
+        }
+
+        // Only drive takes a fourth field, and nothing may follow the last one.
+        if (entry[consumed] != '\0' || (fields == 4) != (strcmp(kind, "drive") == 0))
+            return 0;
+
+        TimelineEvent &event = out[0];
+        event.atMs = baseMs + (unsigned long)offsetMs;
+
+        if (strcmp(kind, "drive") == 0)
+        {
+            event.action = TIMELINE_DRIVE;
+            event.a = (int16_t)constrain(x, -255L, 255L);
+            event.b = (int16_t)constrain(y, -255L, 255L);
+            return 1;
+        }
+
+        if (strcmp(kind, "gauge") == 0 && x > 0)
+        {
+            event.action = TIMELINE_GAUGE;
+            event.a = 1;
+            out[1] = event;
+            out[1].atMs = event.atMs + (unsigned long)x;
+            out[1].a = 0;
+            return 2;
+        }
+
+        if (strcmp(kind, "sound") == 0)
+        {
+            if (x < 0 || x >= AUDIO_CLIP_COUNT)
+                return 0;
+            event.action = TIMELINE_SOUND;
+            event.a = (int16_t)x;
+            return 1;
+        }
+
+        int servoId = strcmp(kind, "head") == 0       ? RobotConst::HEAD_SERVO_ID
+                      : strcmp(kind, "left_arm") == 0  ? RobotConst::LEFT_ARM_SERVO_ID
+                      : strcmp(kind, "right_arm") == 0 ? RobotConst::RIGHT_ARM_SERVO_ID
+                                                       : -1;
+        if (servoId < 0)
+            return 0;
+
+        event.action = TIMELINE_SERVO;
+        event.a = (int16_t)servoId;
+        event.b = (int16_t)constrain(x, 0L, 180L);
+        return 1;
+    }
+}
+
+void initTimeline()
+{
+    clearTimeline();
+    dispatchedCount = 0;
+    rejectedCount = 0;
+    maxLateMs = 0;
+}
+
+bool scheduleTimelineEvent(const TimelineEvent &event)
+{
+    if (heapSize >= RobotConst::TIMELINE_CAPACITY)
+    {
+        rejectedCount++;
+        return false;
+    }
+
+    heap[heapSize].event = event;
+    heap[heapSize].order = nextOrder++;
+    siftUp(heapSize);
+    heapSize++;
+    return true;
+}
+
+// Comma-separated entries, offsets relative to baseMs. Either every entry is
+// queued or none is; returns the number of events queued, or -1.
+int parseTimelineSpec(const char *spec, unsigned long baseMs, TimelineEvent *out)
+{
+    int parsedCount = 0;
+
+    while (*spec != '\0')
+    {
+        char entry[48];
+        size_t len = strcspn(spec, ",");
+        if (len == 0 || len >= sizeof(entry) || parsedCount + 2 > RobotConst::TIMELINE_CAPACITY)
+            return -1;
+
+        memcpy(entry, spec, len);
+        entry[len] = '\0';
+        int produced = parseSpecEntry(entry, baseMs, out + parsedCount);
+        if (produced == 0)
+            return -1;
+
+        parsedCount += produced;
+        spec += len;
+        if (*spec == ',' && *++spec == '\0')
+            return -1;
+    }
+
+    return parsedCount > 0 ? parsedCount : -1;
+}
+
+bool scheduleTimelineEvents(const TimelineEvent *events, int count)
+{
+    if (heapSize + count > RobotConst::TIMELINE_CAPACITY)
+        return false;
+
+    for (int i = 0; i < count; i++)
+        scheduleTimelineEvent(events[i]);
+    return true;
+}
+
+void clearTimeline()
+{
+    heapSize = 0;
+}
+
+// Every event due at this tick is dispatched before returning, so motion,
+// servos and the gauge change together.
+void updateTimeline()
+{
+    if (heapSize == 0)
+        return;
+
+    unsigned long now = millis();
+    while (heapSize > 0 && (long)(heap[0].event.atMs - now) <= 0)
+    {
+        unsigned long lateMs = now - heap[0].event.atMs;
+        if (lateMs > maxLateMs)
+            maxLateMs = lateMs;
+
+        dispatch(popEarliest());
+        dispatchedCount++;
+    }
+}
+
+unsigned long getTimelineDueInMs()
+{
+    if (heapSize == 0)
+        return RobotConst::NO_DEADLINE_MS;
+
+    long remaining = (long)(heap[0].event.atMs - millis());
+    return remaining > 0 ? (unsigned long)remaining : 0;
+}
+
+void appendTimelineStatus(ResponseWriter &out)
+{
+    appendResponseFormat(out, ",\"timeline\":{\"queued\":%d,\"dispatched\":%lu,\"rejected\":%lu,\"max_late_ms\":%lu}",
+                         heapSize, (unsigned long)dispatchedCount, (unsigned long)rejectedCount, maxLateMs);
+}
@@ -0,0 +1,41 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <Arduino.h>
+
+#include "response_writer.h"
+
+enum TimelineAction : uint8_t
+{
+    TIMELINE_DRIVE,
+    TIMELINE_SERVO,
+    TIMELINE_GAUGE,
+    TIMELINE_SOUND
+};
+
+// DRIVE: a = left speed, b = right speed
+// SERVO: a = servo id, b = angle
+// GAUGE: a = 1 to highlight, 0 to restore
+// SOUND: a = clip id
+struct TimelineEvent
+{
+    unsigned long atMs;
+    TimelineAction action;
+    int16_t a;
+    int16_t b;
+};
+
+void initTimeline();
+bool scheduleTimelineEvent(const TimelineEvent &event);
+// Parses "<offset_ms>:<kind>:<x>[:<y>],..." into out, which holds
+// TIMELINE_CAPACITY events. Returns the event count, or -1 if any entry is
+// invalid.
+int parseTimelineSpec(const char *spec, unsigned long baseMs, TimelineEvent *out);
+// Queues all of the events or, if they do not fit, none of them.
+bool scheduleTimelineEvents(const TimelineEvent *events, int count);
+void clearTimeline();
+void updateTimeline();
+unsigned long getTimelineDueInMs();
+void appendTimelineStatus(ResponseWriter &out);
+
+#endif
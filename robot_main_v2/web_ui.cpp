@@ -104,6 +104,24 @@ namespace
 			</div>
 		</div>
 
+		<div class="card">
+			<h2>Sounds</h2>
+			<div class="row">
+				<button onclick="send('sound','beep')">Beep</button>
+				<button onclick="send('sound','whirr')">Whirr</button>
+				<button onclick="send('sound','boot')">Boot</button>
+			</div>
+		</div>
+
+		<div class="card">
+			<h2>Teach</h2>
+			<div class="row">
+				<button onclick="sendTeach('record')">Record</button>
+				<button onclick="sendTeach('stop')">Save</button>
+				<button onclick="sendTeach('replay')">Replay</button>
+			</div>
+		</div>
+
 		<div class="status" id="status">Last command: none</div>
 	</div>
 
@@ -125,6 +143,12 @@ namespace
 			await send('system', action);
 		}
 
+		async function sendTeach(action) {
+			const res = await fetch(`/teach?action=${encodeURIComponent(action)}`);
+			const text = await res.text();
+			setStatusText(`Last command: ${text}`);
+		}
+
         async function sendMotion(action) {
             const url = `/cmd?target=motion&action=${encodeURIComponent(action)}&speed=${encodeURIComponent(motionSpeed)}`;
             const res = await fetch(url);
@@ -135,8 +159,10 @@ namespace
 		async function refreshStatus() {
 			try {
 				const res = await fetch('/status');
-				const text = await res.text();
-				setStatusText(text);
+				const s = await res.json();
+				setStatusText(`Last: ${s.last} | drive: ${s.modes.auto_drive ? 'auto' : 'manual'}` +
+					` | pose: ${s.modes.auto_pose ? 'on' : 'off'} | charge: ${s.charge.level}/${s.charge.bars}` +
+					` | power: ${s.power.state} | teach: ${s.teach.state} (${s.teach.steps})`);
 			} catch (_) {
 			}
 		}
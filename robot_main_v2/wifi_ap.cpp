@@ -1,20 +1,177 @@
 #include <WiFi.h>
+#include <esp_wifi.h>
 
+#include "channel_select.h"
+#include "robot_constants.h"
 #include "wifi_ap.h"
 
 namespace
 {
     constexpr char AP_SSID[] = "ESP32-Robot-Control";
     constexpr char AP_PASSWORD[] = "robot1234";
+
+    // Shared network for multi-robot choreography; leave empty to run AP only.
+    constexpr char SHOW_SSID[] = "";
+    constexpr char SHOW_PASSWORD[] = "";
+
+    struct StationRecord
+    {
+        uint8_t mac[6];
+        bool used;
+        bool connected;
+        uint32_t joins;
+        uint16_t lastReason;
+    };
+
+    uint8_t apChannel = 0;
+    int scannedNetworks = -1;
+
+    // Station events arrive on the Arduino event task, /status reads the
+    // table from loop().
+    portMUX_TYPE stationLock = portMUX_INITIALIZER_UNLOCKED;
+    StationRecord stations[RobotConst::AP_STATION_TABLE_SIZE];
+    int connectedStations = 0;
+
+    // Blocking active scan over all channels, roughly
+    // AP_CHANNEL_MAX × AP_SCAN_MS_PER_CHANNEL. Falls back to the first
+    // candidate if the scan fails.
+    uint8_t scanForQuietestChannel()
+    {
+        WiFi.mode(WIFI_STA);
+        int found = WiFi.scanNetworks(false, true, false, RobotConst::AP_SCAN_MS_PER_CHANNEL);
+        scannedNetworks = found;
+        if (found < 0)
+        {
+            Serial.println("[ERROR] Wi-Fi scan failed, using default AP channel");
+            return RobotConst::AP_CHANNEL_CANDIDATES[0];
+        }
+
+        ScanSample samples[RobotConst::AP_SCAN_MAX_RESULTS];
+        int count = min(found, RobotConst::AP_SCAN_MAX_RESULTS);
+        for (int i = 0; i < count; i++)
+            samples[i] = {(uint8_t)WiFi.channel(i), (int8_t)WiFi.RSSI(i)};
+        WiFi.scanDelete();
+
+        return selectQuietestChannel(samples, count);
+    }
+
+    StationRecord *findStation(const uint8_t mac[6])
+    {
+        for (StationRecord &record : stations)
+        {
+            if (record.used && memcmp(record.mac, mac, sizeof(record.mac)) == 0)
+                return &record;
+        }
+        return nullptr;
+    }
+
+    // Reuses a free slot, otherwise the disconnected station with the
+    // fewest joins.
+    StationRecord *claimStation(const uint8_t mac[6])
+    {
+        StationRecord *slot = nullptr;
+        for (StationRecord &record : stations)
+        {
+            if (!record.used)
+            {
+                slot = &record;
+                break;
+            }
+            if (!record.connected && (slot == nullptr || record.joins < slot->joins))
+                slot = &record;
+        }
+
+        if (slot != nullptr)
+        {
+            *slot = {};
+            memcpy(slot->mac, mac, sizeof(slot->mac));
+            slot->used = true;
+        }
+        return slot;
+    }
+
+    void onStationEvent(arduino_event_id_t event, arduino_event_info_t info)
+    {
+        bool joined = event == ARDUINO_EVENT_WIFI_AP_STACONNECTED;
+        const uint8_t *mac = joined ? info.wifi_ap_staconnected.mac : info.wifi_ap_stadisconnected.mac;
+
+        portENTER_CRITICAL(&stationLock);
+        StationRecord *record = findStation(mac);
+        if (record == nullptr && joined)
+            record = claimStation(mac);
+
+        if (record != nullptr && record->connected != joined)
+        {
+            record->connected = joined;
+            connectedStations += joined ? 1 : -1;
+            if (joined)
+                record->joins++;
+            else
+                record->lastReason = info.wifi_ap_stadisconnected.reason;
+        }
+        portEXIT_CRITICAL(&stationLock);
+    }
+
+    void appendMac(ResponseWriter &out, const uint8_t mac[6])
+    {
+        appendResponseFormat(out, "\"%02x:%02x:%02x:%02x:%02x:%02x\"", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    }
 }
 
 bool startRobotAccessPoint()
 {
-    WiFi.mode(WIFI_AP);
-    return WiFi.softAP(AP_SSID, AP_PASSWORD);
+    WiFi.onEvent(onStationEvent, ARDUINO_EVENT_WIFI_AP_STACONNECTED);
+    WiFi.onEvent(onStationEvent, ARDUINO_EVENT_WIFI_AP_STADISCONNECTED);
+
+    if (SHOW_SSID[0] == '\0')
+    {
+        apChannel = scanForQuietestChannel();
+        Serial.print("[INFO] AP channel: ");
+        Serial.println(apChannel);
+
+        WiFi.mode(WIFI_AP);
+        return WiFi.softAP(AP_SSID, AP_PASSWORD, apChannel, 0, RobotConst::AP_MAX_STATIONS);
+    }
+
+    // The radio has a single channel, so the AP follows the show network's
+    // channel once the station side associates.
+    WiFi.mode(WIFI_AP_STA);
+    WiFi.setAutoReconnect(true);
+    WiFi.begin(SHOW_SSID, SHOW_PASSWORD);
+    return WiFi.softAP(AP_SSID, AP_PASSWORD, RobotConst::AP_CHANNEL_CANDIDATES[0], 0, RobotConst::AP_MAX_STATIONS);
+}
+
+bool isShowNetworkConfigured()
+{
+    return SHOW_SSID[0] != '\0';
 }
 
 const char *getRobotAccessPointSsid()
 {
     return AP_SSID;
 }
+
+void appendWifiStatus(ResponseWriter &out)
+{
+    wifi_sta_list_t live = {};
+    esp_wifi_ap_get_sta_list(&live);
+
+    appendResponseFormat(out, ",\"wifi\":{\"channel\":%u,\"scanned\":%d,\"max_stations\":%d,\"stations\":[",
+                         (unsigned)WiFi.channel(), scannedNetworks, RobotConst::AP_MAX_STATIONS);
+
+    bool first = true;
+    for (int i = 0; i < live.num; i++)
+    {
+        portENTER_CRITICAL(&stationLock);
+        StationRecord *found = findStation(live.sta[i].mac);
+        StationRecord record = found != nullptr ? *found : StationRecord{};
+        portEXIT_CRITICAL(&stationLock);
+
+        appendResponse(out, first ? "{\"mac\":" : ",{\"mac\":");
+        appendMac(out, live.sta[i].mac);
+        appendResponseFormat(out, ",\"rssi\":%d,\"joins\":%lu,\"last_reason\":%u}", live.sta[i].rssi,
+                             (unsigned long)record.joins, (unsigned)record.lastReason);
+        first = false;
+    }
+    appendResponse(out, "]}");
+}
@@ -1,7 +1,11 @@
 #ifndef WIFI_AP_H
 #define WIFI_AP_H
 
+#include "response_writer.h"
+
 bool startRobotAccessPoint();
 const char *getRobotAccessPointSsid();
+bool isShowNetworkConfigured();
+void appendWifiStatus(ResponseWriter &out);
 
 #endif